@@ -31,7 +31,6 @@
 #define Spine_Animation_h
 
 #include <spine/Vector.h>
-#include <spine/HashMap.h>
 #include <spine/MixBlend.h>
 #include <spine/MixDirection.h>
 #include <spine/SpineObject.h>
@@ -47,6 +46,12 @@ namespace spine {
 
 	class AnimationState;
 
+	class TimelineGroup;
+
+	class EventTimeline;
+
+	class SkeletonData;
+
 	class SP_API Animation : public SpineObject {
 		friend class AnimationState;
 
@@ -54,6 +59,8 @@ namespace spine {
 
 		friend class AnimationStateData;
 
+		friend class SkeletonData;
+
 		friend class AttachmentTimeline;
 
 		friend class RGBATimeline;
@@ -112,17 +119,56 @@ namespace spine {
 
 		bool hasTimeline(Vector<PropertyId> &ids);
 
+		/// Maps the property IDs of the timelines to dense indices of the skeleton data, which AnimationState uses to find
+		/// overlapping timelines with bitsets. SkeletonJson and SkeletonBinary index the animations they read. Animations
+		/// created at runtime should be indexed when created, else AnimationState indexes them when first set on a track,
+		/// under a lock of the skeleton data. An animation is indexed for one skeleton data at a time, except an animation
+		/// without timelines, which has nothing to index and may be shared.
+		void indexProperties(SkeletonData &skeletonData);
+
+		/// Groups the bone rotate, translate and shear timelines by type, so apply() and AnimationState apply each group in
+		/// one loop instead of calling each timeline. The other timelines are applied in their order first. The timelines
+		/// and their order in getTimelines() don't change.
+		void groupTimelines();
+
+		/// The groups created by groupTimelines(), if any.
+		Vector<TimelineGroup *> &getTimelineGroups();
+
 		float getDuration();
 
 		void setDuration(float inValue);
 
+		/// Returns the index of the last frame at or before the target, or 0 if the target is before the first frame.
 		/// @param target After the first and before the last entry.
 		static int search(Vector<float> &values, float target);
 
 		static int search(Vector<float> &values, float target, int step);
+
+		/// Checks the frame at the cursor and the frame after it before a binary search, then stores the result in the
+		/// cursor. A cursor must only be used with the frames of a single timeline. AnimationState keeps one per timeline
+		/// of each TrackEntry and passes it to Timeline::apply().
+		/// @param cursor May be NULL to always use a binary search.
+		static int search(Vector<float> &values, float target, int step, int *cursor);
+		/// An ID unique to this animation for the lifetime of the process, which unlike the animation's address is never
+		/// reused by another animation. AnimationStateData memoizes timeline modes by it.
+		size_t getId();
+
 	private:
+		/// @return True if this animation has any property of the other animation's timeline. Both must be indexed for the
+		/// same skeleton data, unless this animation has no timelines.
+		bool hasProperties(Animation &animation, size_t timelineIndex);
+
+		size_t _id;
+		size_t _propertyHash; // A hash of the property IDs of each timeline, in timeline order.
 		Vector<Timeline *> _timelines;
-		HashMap<PropertyId, bool> _timelineIds;
+		Vector<TimelineGroup *> _timelineGroups;
+		Vector<int> _ungroupedTimelines;
+		Vector<PropertyId> _timelineIds;
+		SkeletonData *_propertyIndexData;
+		Vector<int> _propertyIndices; // The dense property indices of all timelines.
+		Vector<int> _propertyStarts; // The first of _propertyIndices for each timeline, and the end.
+		Vector<unsigned int> _propertyBits; // A bit for each dense property index of the animation.
+		Vector<EventTimeline *> _eventTimelines;
 		float _duration;
 		String _name;
 	};
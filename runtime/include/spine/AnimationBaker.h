@@ -0,0 +1,72 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_AnimationBaker_h
+#define Spine_AnimationBaker_h
+
+#include <spine/SpineObject.h>
+
+namespace spine {
+	class Animation;
+
+	class BakedAnimation;
+
+	class SkeletonData;
+
+	/// Samples animations into BakedAnimation tables, trading memory for cheaper playback of many skeletons.
+	class SP_API AnimationBaker : public SpineObject {
+	public:
+		/// @param frameRate The number of samples per second. The samples are spread evenly over the duration of each
+		/// animation, so the actual interval may be slightly shorter.
+		AnimationBaker(SkeletonData *skeletonData, float frameRate);
+
+		~AnimationBaker();
+
+		/// Samples the animation with MixBlend_Setup and an alpha of 1 on a skeleton in the setup pose, with all bones
+		/// active. The returned baked animation is owned by the caller.
+		BakedAnimation *bake(Animation &animation);
+
+		/// Applies the source animation and the baked animation at the given number of evenly spaced times per sample
+		/// interval and returns the largest difference of any baked value, in degrees for rotations and in the units of
+		/// the value otherwise.
+		float getError(BakedAnimation &bakedAnimation, int subdivisions);
+
+		SkeletonData *getSkeletonData();
+
+		float getFrameRate();
+
+		void setFrameRate(float inValue);
+
+	private:
+		SkeletonData *_skeletonData;
+		float _frameRate;
+	};
+}
+
+#endif /* Spine_AnimationBaker_h */
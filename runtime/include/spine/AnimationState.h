@@ -37,6 +37,7 @@
 #include <spine/SpineObject.h>
 #include <spine/SpineString.h>
 #include <spine/HasRendererObject.h>
+#include <spine/TimelineModes.h>
 #include "Slot.h"
 
 #ifdef SPINE_USE_STD_FUNCTION
@@ -53,6 +54,17 @@ namespace spine {
 		EventType_Event
 	};
 
+	/// Bits of the event types, for TrackEntry::setEventMask() and AnimationState::setEventMask().
+	enum EventMask {
+		EventMask_Start = 1 << EventType_Start,
+		EventMask_Interrupt = 1 << EventType_Interrupt,
+		EventMask_End = 1 << EventType_End,
+		EventMask_Complete = 1 << EventType_Complete,
+		EventMask_Dispose = 1 << EventType_Dispose,
+		EventMask_Event = 1 << EventType_Event,
+		EventMask_All = (1 << (EventType_Event + 1)) - 1
+	};
+
 	class AnimationState;
 
 	class TrackEntry;
@@ -65,6 +77,8 @@ namespace spine {
 
 	class Skeleton;
 
+	class PoseBuffer;
+
 	class RotateTimeline;
 
 	class AttachmentTimeline;
@@ -271,6 +285,12 @@ namespace spine {
 
 		void setListener(AnimationStateListenerObject *listener);
 
+		/// The event types, as EventMask bits, for which this entry's listener is called. Events of types neither this
+		/// entry nor the animation state listen to are not queued. Default is EventMask_All.
+		int getEventMask();
+
+		void setEventMask(int eventMask);
+
 	private:
 		Animation *_animation;
 		TrackEntry *_previous;
@@ -288,10 +308,15 @@ namespace spine {
 		Vector<int> _timelineMode;
 		Vector<TrackEntry *> _timelineHoldMix;
 		Vector<float> _timelinesRotation;
+		Vector<int> _timelineCursors;
 		AnimationStateListener _listener;
 		AnimationStateListenerObject *_listenerObject;
+		int _eventMask;
 
 		void reset();
+
+		/// Sets the track time as if it was reached by playing, so the next apply continues from it.
+		void skipTo(float trackTime);
 	};
 
 	class SP_API EventQueueEntry : public SpineObject {
@@ -309,7 +334,11 @@ namespace spine {
 		friend class AnimationState;
 
 	private:
+		/// A ring buffer of queued entries, starting at _head. Grows when full, so it stops allocating once it has grown to
+		/// the most events queued at a time.
 		Vector<EventQueueEntry> _eventQueueEntries;
+		size_t _head;
+		size_t _count;
 		AnimationState &_state;
 		bool _drainDisabled;
 
@@ -321,6 +350,14 @@ namespace spine {
 
 		~EventQueue();
 
+		/// Returns true if the track entry or the animation state listens to the event type.
+		bool isListened(TrackEntry *entry, EventType eventType);
+
+		void add(EventType eventType, TrackEntry *entry, Event *event = NULL);
+
+		/// Calls the track entry and animation state listeners that listen to the event type.
+		void notify(EventType eventType, TrackEntry *entry, Event *event);
+
 		void start(TrackEntry *entry);
 
 		void interrupt(TrackEntry *entry);
@@ -355,6 +392,30 @@ namespace spine {
 		/// animation state can be applied to multiple skeletons to pose them identically.
 		bool apply(Skeleton &skeleton);
 
+		/// Poses the skeleton like apply(Skeleton &), then captures its pose. Listeners are not invoked: events stay queued
+		/// until the next call to update() or apply(Skeleton &). Animation states of different skeletons can then be applied
+		/// on other threads to private copies of the skeletons, and each pose committed to its displayed skeleton later.
+		bool apply(Skeleton &skeleton, PoseBuffer &pose);
+
+		/// Raises the events and completions apply(Skeleton &) would raise, without posing a skeleton. The next apply()
+		/// continues from this time, so a skeleton can be posed less often than the events are raised.
+		bool applyEvents();
+
+		/// Moves the current entry of a track to the specified track time without applying any frames in between, so the
+		/// next apply() poses the skeleton directly at that time. A delay that hasn't passed is skipped and a mix in progress
+		/// is completed. Queued entries start with the next update() if the new time passes their delay.
+		/// @param fireEvents If true, the events and completions between the last applied time and the new time are raised,
+		/// as they would be by playing the interval. Otherwise they are discarded. No events are raised when seeking back.
+		/// @return The current entry of the track, or NULL if the track is empty.
+		TrackEntry *seek(size_t trackIndex, float trackTime, bool fireEvents);
+
+		/// Advances all tracks by the specified time as update() does, but like seek() without applying the frames in
+		/// between and completing mixes in progress. Queued entries whose delay passes within the time are started in turn,
+		/// each with its mix completed and the leftover time carried over, so the result matches updating to the same time
+		/// once all mixes have finished. When a listener replaces the current entry of a track, that track stops there and
+		/// the new entry starts at 0.
+		void fastForward(float delta, bool fireEvents);
+
 		/// Removes all animations from all tracks, leaving skeletons in their previous pose.
 		/// It may be desired to use AnimationState.setEmptyAnimations(float) to mix the skeletons back to the setup pose,
 		/// rather than leaving them in their previous pose.
@@ -432,6 +493,11 @@ namespace spine {
 
         bool getManualTrackEntryDisposal();
 
+		/// The event types, as EventMask bits, for which the animation state listener is called. Default is EventMask_All.
+		int getEventMask();
+
+		void setEventMask(int eventMask);
+
 		void disposeTrackEntry(TrackEntry *entry);
 
 	private:
@@ -451,7 +517,8 @@ namespace spine {
 		Vector<Event *> _events;
 		EventQueue *_queue;
 
-		HashMap<PropertyId, bool> _propertyIDs;
+		Vector<unsigned int> _propertyBits; // A bit for each dense property index set by computeHold().
+		TimelineModes _timelineModes; // The key and modes of the current track layout.
 		bool _animationsChanged;
 
 		AnimationStateListener _listener;
@@ -463,14 +530,16 @@ namespace spine {
 
 		bool _manualTrackEntryDisposal;
 
+		int _eventMask;
+
 		static Animation *getEmptyAnimation();
 
 		static void
 		applyRotateTimeline(RotateTimeline *rotateTimeline, Skeleton &skeleton, float time, float alpha, MixBlend pose,
-							Vector<float> &timelinesRotation, size_t i, bool firstFrame);
+							Vector<float> &timelinesRotation, size_t i, bool firstFrame, int *searchCursor);
 
 		void applyAttachmentTimeline(AttachmentTimeline *attachmentTimeline, Skeleton &skeleton, float animationTime,
-									 MixBlend pose, bool firstFrame);
+									 MixBlend pose, bool firstFrame, int *searchCursor);
 
 		/// Returns true when all mixing from entries are complete.
 		bool updateMixingFrom(TrackEntry *to, float delta);
@@ -479,6 +548,14 @@ namespace spine {
 
 		void queueEvents(TrackEntry *entry, float animationTime);
 
+		/// Queues the events and completions of the entry between its last applied time and the track time.
+		void queueSkippedEvents(TrackEntry *entry, float trackTime);
+
+		/// Adds the events of the entry's animation after lastTime up to and including time.
+		void collectEvents(TrackEntry *entry, float lastTime, float time);
+
+		void applyMixingFromEvents(TrackEntry *to);
+
 		/// Sets the active TrackEntry for a given track number.
 		void setCurrent(size_t index, TrackEntry *current, bool interrupt);
 
@@ -493,8 +570,21 @@ namespace spine {
 
 		void animationsChanged();
 
+		/// Sets the bits of the timeline's properties in _propertyBits.
+		/// @return True if any of the bits was not set.
+		bool addProperties(Animation &animation, size_t timelineIndex);
+
 		void computeHold(TrackEntry *entry);
 
+		/// Sets the key of _timelineModes from the track entries and the flags computeHold() reads.
+		void buildTimelineModeKey();
+
+		/// Copies the modes of the entries computeHold() is called for from or to _timelineModes.
+		/// @return False if the memoized modes don't fit the timelines of the entries, so they must be computed.
+		bool loadTimelineModes();
+
+		void saveTimelineModes();
+
 		void setAttachment(Skeleton &skeleton, spine::Slot &slot, const String &attachmentName, bool attachments);
 	};
 }
@@ -30,9 +30,9 @@
 #ifndef Spine_AnimationStateData_h
 #define Spine_AnimationStateData_h
 
-#include <spine/HashMap.h>
 #include <spine/SpineObject.h>
 #include <spine/SpineString.h>
+#include <spine/Vector.h>
 
 #include <assert.h>
 
@@ -41,6 +41,8 @@ namespace spine {
 
 	class Animation;
 
+	class TimelineModes;
+
 	/// Stores mix (crossfade) durations to be applied when AnimationState animations are changed.
 	class SP_API AnimationStateData : public SpineObject {
 		friend class AnimationState;
@@ -48,6 +50,8 @@ namespace spine {
 	public:
 		explicit AnimationStateData(SkeletonData *skeletonData);
 
+		~AnimationStateData();
+
 		/// The SkeletonData to look up animations when they are specified by name.
 		SkeletonData *getSkeletonData();
 
@@ -59,8 +63,8 @@ namespace spine {
 		/// Sets a mix duration by animation names.
 		void setMix(const String &fromName, const String &toName, float duration);
 
-		/// Sets a mix duration when changing from the specified animation to the other.
-		/// See TrackEntry.MixDuration.
+		/// Sets a mix duration when changing from the specified animation to the other. Mixes are keyed by the animation
+		/// instances. See TrackEntry.MixDuration.
 		void setMix(Animation *from, Animation *to, float duration);
 
 		/// The mix duration to use when changing from the specified animation to the other,
@@ -70,20 +74,52 @@ namespace spine {
 		/// Removes all mixes and sets the default mix to 0.
 		void clear();
 
+		/// The number of track layouts whose timeline modes are memoized for the animation states using this data, so
+		/// repeated transitions don't compute them again. 0 disables memoization. Default is 64.
+		size_t getTimelineModeCacheSize();
+
+		void setTimelineModeCacheSize(size_t inValue);
+
 	private:
-		class AnimationPair : public SpineObject {
+		class MixEntry : public SpineObject {
 		public:
-			Animation *_a1;
-			Animation *_a2;
+			Animation *_from;
+			Animation *_to;
+			float _duration;
 
-			explicit AnimationPair(Animation *a1 = NULL, Animation *a2 = NULL);
-
-			bool operator==(const AnimationPair &other) const;
+			explicit MixEntry(Animation *from = NULL, Animation *to = NULL, float duration = 0);
 		};
 
 		SkeletonData *_skeletonData;
 		float _defaultMix;
-		HashMap<AnimationPair, float> _animationToMixTime;
+		/// Open addressing hash table keyed by the animation pair, with linear probing. The size is a power of 2 and at
+		/// least twice the number of mixes. Empty entries have a null _from.
+		Vector<MixEntry> _mixes;
+		size_t _mixCount;
+
+		static size_t hash(Animation *from, Animation *to);
+
+		/// @return The index of the entry for the animation pair, or of the empty entry where it would be added.
+		size_t find(Animation *from, Animation *to);
+
+		void resize(size_t capacity);
+
+		struct TimelineModeCache;
+
+		/// Memoized TimelineModes, guarded by a lock since animation states sharing this data may be applied on different
+		/// threads.
+		TimelineModeCache *_timelineModeCache;
+
+		/// Copies the memoized modes matching the key of the specified modes into them.
+		/// @return False if there are none.
+		bool findTimelineModes(TimelineModes &modes);
+
+		/// Memoizes a copy of the specified modes, replacing those with the same key, else the oldest when full.
+		void addTimelineModes(TimelineModes &modes);
+
+		AnimationStateData(const AnimationStateData &);
+
+		AnimationStateData &operator=(const AnimationStateData &);
 	};
 }
 
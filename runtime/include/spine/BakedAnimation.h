@@ -0,0 +1,125 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_BakedAnimation_h
+#define Spine_BakedAnimation_h
+
+#include <spine/MixBlend.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	class Animation;
+
+	class Event;
+
+	class Skeleton;
+
+	class Slot;
+
+	class Timeline;
+
+	/// An animation sampled at a fixed rate by AnimationBaker.
+	///
+	/// Bone local transforms and slot colors are stored as dense tables with one row per sample and are linearly
+	/// interpolated between samples, skipping curve evaluation and the per timeline virtual calls. Attachment, draw order
+	/// and event timelines, timelines with stepped frames and any other timeline that does not key a bone transform or a
+	/// slot color are applied from the source animation, so attachment switches, draw order changes, steps and events
+	/// happen at their exact times.
+	///
+	/// The source animation is not copied and must outlive the baked animation.
+	class SP_API BakedAnimation : public SpineObject {
+		friend class AnimationBaker;
+
+	public:
+		~BakedAnimation();
+
+		/// Applies the samples and the remaining timelines to the skeleton. Blends the same way as
+		/// Animation::apply(Skeleton&, float, float, bool, Vector<Event*>*, float, MixBlend, MixDirection) with
+		/// MixDirection_In, except that before the first key of a timeline MixBlend_Replace moves the value towards the
+		/// setup pose instead of leaving it unchanged.
+		void apply(Skeleton &skeleton, float lastTime, float time, bool loop, Vector<Event *> *pEvents, float alpha,
+				   MixBlend blend);
+
+		Animation &getAnimation();
+
+		float getDuration();
+
+		/// The number of samples per second requested from the baker.
+		float getFrameRate();
+
+		/// The number of samples, including one at time 0 and one at the duration.
+		size_t getFrameCount();
+
+		/// The time between two samples. Never more than 1 / getFrameRate().
+		float getFrameInterval();
+
+		/// The timelines of the source animation that are applied as is.
+		Vector<Timeline *> &getTimelines();
+
+		/// The number of floats stored per sample.
+		size_t getValueCount();
+
+	private:
+		Animation &_animation;
+		float _frameRate;
+		size_t _frameCount;
+		float _frameInterval;
+		Vector<Timeline *> _timelines;
+
+		/// Bone index and PoseChannel of each baked bone value, then its setup pose value.
+		Vector<int> _bones;
+		Vector<int> _boneChannels;
+		Vector<float> _boneSetup;
+
+		/// Slot index and component of each baked color value, 0-3 for the color and 4-6 for the dark color, then its
+		/// setup pose value.
+		Vector<int> _slots;
+		Vector<int> _slotChannels;
+		Vector<float> _slotSetup;
+
+		/// One row of bone values followed by slot values per sample.
+		Vector<float> _values;
+
+		BakedAnimation(Animation &animation, float frameRate, size_t frameCount);
+
+		void addBoneValue(int bone, int channel, float setup);
+
+		void addSlotValue(int slot, int channel, float setup);
+
+		/// Stores the current values of the skeleton as the given sample.
+		void setFrame(size_t frame, Skeleton &skeleton);
+
+		static float &getSlotValue(Slot &slot, int component);
+
+		/// Writes the baked values interpolated between two samples to the skeleton.
+		void applyValues(Skeleton &skeleton, size_t frame, float percent, float alpha, MixBlend blend);
+	};
+}
+
+#endif /* Spine_BakedAnimation_h */
@@ -31,6 +31,7 @@
 #define Spine_Bone_h
 
 #include <spine/Updatable.h>
+#include <spine/SkeletonPose.h>
 #include <spine/SpineObject.h>
 #include <spine/Vector.h>
 
@@ -100,9 +101,17 @@ namespace spine {
 
 		static bool isYDown();
 
+		/// Creates a bone with a pose of its own, so no bone of the skeleton is changed by it.
 		/// @param parent May be NULL.
 		Bone(BoneData &data, Skeleton &skeleton, Bone *parent = NULL);
 
+		/// Creates a bone whose transform values are stored in the pose at the index, and sets them to the setup pose. The
+		/// pose must outlive the bone. Skeleton binds its bones to its SkeletonPose at the index of their bone data.
+		/// @param parent May be NULL.
+		Bone(BoneData &data, Skeleton &skeleton, Bone *parent, SkeletonPose &pose, int index);
+
+		virtual ~Bone();
+
 		/// Same as updateWorldTransform. This method exists for Bone to implement Spine::Updatable.
 		virtual void update();
 
@@ -260,12 +269,36 @@ namespace spine {
 		Skeleton &_skeleton;
 		Bone *_parent;
 		Vector<Bone *> _children;
-		float _x, _y, _rotation, _scaleX, _scaleY, _shearX, _shearY;
-		float _ax, _ay, _arotation, _ascaleX, _ascaleY, _ashearX, _ashearY;
-		float _a, _b, _worldX;
-		float _c, _d, _worldY;
+		SkeletonPose *_pose;
+		int _index;
 		bool _sorted;
 		bool _active;
+		bool _ownsPose;
+
+		// The bone's transform values in its SkeletonPose.
+		float &_x() { return _pose->getChannel(PoseChannel_X)[_index]; }
+		float &_y() { return _pose->getChannel(PoseChannel_Y)[_index]; }
+		float &_rotation() { return _pose->getChannel(PoseChannel_Rotation)[_index]; }
+		float &_scaleX() { return _pose->getChannel(PoseChannel_ScaleX)[_index]; }
+		float &_scaleY() { return _pose->getChannel(PoseChannel_ScaleY)[_index]; }
+		float &_shearX() { return _pose->getChannel(PoseChannel_ShearX)[_index]; }
+		float &_shearY() { return _pose->getChannel(PoseChannel_ShearY)[_index]; }
+		float &_ax() { return _pose->getChannel(PoseChannel_AX)[_index]; }
+		float &_ay() { return _pose->getChannel(PoseChannel_AY)[_index]; }
+		float &_arotation() { return _pose->getChannel(PoseChannel_ARotation)[_index]; }
+		float &_ascaleX() { return _pose->getChannel(PoseChannel_AScaleX)[_index]; }
+		float &_ascaleY() { return _pose->getChannel(PoseChannel_AScaleY)[_index]; }
+		float &_ashearX() { return _pose->getChannel(PoseChannel_AShearX)[_index]; }
+		float &_ashearY() { return _pose->getChannel(PoseChannel_AShearY)[_index]; }
+		float &_a() { return _pose->getChannel(PoseChannel_A)[_index]; }
+		float &_b() { return _pose->getChannel(PoseChannel_B)[_index]; }
+		float &_worldX() { return _pose->getChannel(PoseChannel_WorldX)[_index]; }
+		float &_c() { return _pose->getChannel(PoseChannel_C)[_index]; }
+		float &_d() { return _pose->getChannel(PoseChannel_D)[_index]; }
+		float &_worldY() { return _pose->getChannel(PoseChannel_WorldY)[_index]; }
+
+		/// Binds to the same bone of another skeleton, whose pose has already been copied into the skeleton's SkeletonPose.
+		Bone(Bone &prototype, Skeleton &skeleton, Bone *parent);
 	};
 }
 
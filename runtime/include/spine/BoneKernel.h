@@ -0,0 +1,70 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_BoneKernel_h
+#define Spine_BoneKernel_h
+
+#include <spine/SpineObject.h>
+
+namespace spine {
+	class SkeletonPose;
+
+	/// Computes bone world transforms several bones at a time, directly on a SkeletonPose.
+	///
+	/// SSE or NEON is used when the compiler targets it, otherwise a scalar loop. Define SPINE_NO_SIMD to force the scalar loop.
+	/// Sine and cosine come from MathUtil::sinCosDeg, so they follow MathUtil's trig mode and the results match
+	/// Bone::updateWorldTransform bit-for-bit. The default TrigMode_Exact calls libm for each bone, with
+	/// TrigMode_Polynomial they are computed four at a time, which makes the kernel about twice as fast.
+	class SP_API BoneKernel : public SpineObject {
+	private:
+		BoneKernel();
+
+	public:
+		/// The number of bones processed per iteration.
+		static const int Width = 4;
+
+		/// Computes the world transform of TransformMode_Normal bones from their applied transform and their parent's world
+		/// transform. The bones are processed in levels: a bone's parent may be in an earlier level, but not in the same one.
+		/// @param bones The bone indices.
+		/// @param parents The parent bone index of each bone.
+		/// @param levelEnds For each level, the index in bones one past its last bone.
+		static void updateNormal(SkeletonPose &pose, const int *bones, const int *parents, const size_t *levelEnds,
+								 size_t levelCount);
+
+		/// Computes the world transform of the same TransformMode_Normal bones in several poses of the same SkeletonData.
+		/// Bone-major: each bone is computed for all poses, several poses at a time, before the next bone.
+		/// @param poses The poses, which must all have the same bone count.
+		/// @param bones The bone indices. A bone's parent must come before it or not be in the list.
+		/// @param parents The parent bone index of each bone.
+		static void updateNormalInstances(SkeletonPose **poses, size_t poseCount, const int *bones, const int *parents,
+										  size_t boneCount);
+	};
+}
+
+#endif /* Spine_BoneKernel_h */
@@ -47,7 +47,7 @@ namespace spine {
 
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, int *searchCursor = NULL);
 
 		/// Sets the time and value of the specified keyframe.
 		void setFrame(int frame, float time, float r, float g, float b, float a);
@@ -80,7 +80,7 @@ namespace spine {
 
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, int *searchCursor = NULL);
 
 		/// Sets the time and value of the specified keyframe.
 		void setFrame(int frame, float time, float r, float g, float b);
@@ -112,7 +112,7 @@ namespace spine {
 
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, int *searchCursor = NULL);
 
 		int getSlotIndex() { return _slotIndex; };
 
@@ -136,7 +136,7 @@ namespace spine {
 
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, int *searchCursor = NULL);
 
 		/// Sets the time and value of the specified keyframe.
 		void setFrame(int frame, float time, float r, float g, float b, float a, float r2, float g2, float b2);
@@ -172,7 +172,7 @@ namespace spine {
 
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, int *searchCursor = NULL);
 
 		/// Sets the time and value of the specified keyframe.
 		void setFrame(int frame, float time, float r, float g, float b, float r2, float g2, float b2);
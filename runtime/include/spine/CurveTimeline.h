@@ -55,13 +55,59 @@ namespace spine {
 
 		Vector<float> &getCurves();
 
+		/// Returns true if any frame before the last holds its values until the next frame.
+		bool hasSteppedFrames();
+
+		/// Replaces the BEZIER_SIZE floats stored per value of each bezier frame with the curve's control points, quantized
+		/// to 16 bits within the range of all control points of the timeline, times relative to the frame's interval.
+		/// Curves are then expanded when they are evaluated and only the frame types remain in getCurves(). Also releases
+		/// the space reserved for beziers that were not set. Call once all frames are set.
+		virtual void quantize();
+
+		/// Returns true if the timeline has quantized bezier curves.
+		bool isQuantized();
+
+		/// Returns the bytes allocated for the frames, curves and quantized curves, including reserved capacity. Shows the
+		/// memory quantize() and removeRedundantFrames() save.
+		virtual size_t getByteCount();
+
+		/// Removes the frames that interpolating linearly, or holding the value, from the previous frame to the next one
+		/// reproduces within the tolerance for every value. Only linear and stepped frames are removed, so bezier curves
+		/// are unchanged. Call once all frames are set and before quantize(). Returns the number of frames removed.
+		virtual size_t removeRedundantFrames(float tolerance);
+
+		/// Removes redundant frames from the rotate and shear timelines within rotateTolerance, in degrees, and from the
+		/// translate timelines within translateTolerance. Other timelines are unchanged, as are all timelines of a negative
+		/// tolerance. Returns the number of frames removed.
+		static size_t removeRedundantFrames(Vector<Timeline *> &timelines, float rotateTolerance, float translateTolerance);
+
 	protected:
+		size_t countBeziers(size_t &valueCount);
+
 		static const int LINEAR = 0;
 		static const int STEPPED = 1;
 		static const int BEZIER = 2;
 		static const int BEZIER_SIZE = 18;
-
-		Vector<float> _curves; // type, x, y, ...
+		static const int BEZIER_SEGMENTS = 14;
+		static const int BEZIER_CONTROLS = 1;
+		static const int BEZIER_VALUES = 5;
+		static const int BEZIER_TABLE_STEPS = 64;
+
+		/// The largest difference from the curve, as a fraction of its value range, that evaluating a bezier from its
+		/// table may have midway between two samples. Sharper curves are computed exactly instead.
+		static const float MaxBezierTableError;
+
+		/// Stores a bezier as the segment count over its interval, its control points and the values at the uniform times
+		/// between its keys. The segment count is negative for curves the table doesn't fit within MaxBezierTableError.
+		static void
+		setBezierTable(float *table, float time1, float value1, float cx1, float cy1, float cx2, float cy2, float time2,
+					   float value2);
+
+		static float getBezierTableValue(const float *table, float time, float time1, float value1, float value2);
+
+		Vector<float> _curves; // type, ..., segments / interval, cx1, cy1, cx2, cy2, value, ...
+		Vector<unsigned short> _quantizedCurves; // cx1, cy1, cx2, cy2, ...
+		float _curveTimeOffset, _curveTimeScale, _curveOffset, _curveScale;
 	};
 
 	class SP_API CurveTimeline1 : public CurveTimeline {
@@ -74,7 +120,13 @@ namespace spine {
 
 		void setFrame(size_t frame, float time, float value);
 
-		float getCurveValue(float time);
+		/// Computes the value at the specified time, which must be at or after the first frame.
+		/// @param searchCursor Passed to Animation::search() to find the frame. May be NULL.
+		float getCurveValue(float time, int *searchCursor = NULL);
+
+		/// Computes the value at the specified time from the frame at index i of getFrames(), as found by
+		/// Animation::search().
+		float getCurveValue(float time, int i);
 
 	protected:
 		static const int ENTRIES = 2;
@@ -93,6 +145,14 @@ namespace spine {
 
 		float getCurveValue(float time);
 
+		/// Computes both values at the specified time, which must be at or after the first frame.
+		/// @param searchCursor Passed to Animation::search() to find the frame. May be NULL.
+		void getCurveValues(float time, float &value1, float &value2, int *searchCursor = NULL);
+
+		/// Computes both values at the specified time from the frame at index i of getFrames(), as found by
+		/// Animation::search().
+		void getCurveValues(float time, int i, float &value1, float &value2);
+
 	protected:
 		static const int ENTRIES = 3;
 		static const int VALUE1 = 1;
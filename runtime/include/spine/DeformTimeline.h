@@ -47,12 +47,24 @@ namespace spine {
 
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, int *searchCursor = NULL);
 
-		/// Sets the time and value of the specified keyframe.
+		/// Sets the time and vertices of the specified keyframe. Only the range of vertices that differs from the setup
+		/// pose is stored.
 		void setFrame(int frameIndex, float time, Vector<float> &vertices);
 
-		Vector <Vector<float>> &getVertices();
+		/// Sets the time of the specified keyframe and the offsets from the setup pose for the vertices starting at
+		/// start. All other vertices are at the setup pose.
+		void setFrame(int frameIndex, float time, size_t start, Vector<float> &offsets);
+
+		/// Computes the vertices of the specified keyframe.
+		void getVertices(int frameIndex, Vector<float> &vertices);
+
+		/// The offsets from the setup pose for the range of vertices each keyframe changes.
+		Vector <Vector<float>> &getOffsets();
+
+		/// The index of the first vertex of each keyframe's offsets.
+		Vector<size_t> &getOffsetStarts();
 
 		VertexAttachment *getAttachment();
 
@@ -64,6 +76,15 @@ namespace spine {
 
 		float getCurvePercent(float time, int frame);
 
+		/// Does nothing, deform curves are percentages shared by all vertices and take little memory next to them.
+		virtual void quantize();
+
+		/// Also counts the vertex offsets of the frames.
+		virtual size_t getByteCount();
+
+		/// Does nothing, deform frames keep their vertices outside of the frame entries the comparison needs.
+		virtual size_t removeRedundantFrames(float tolerance);
+
 		int getSlotIndex() { return _slotIndex; }
 
 		void setSlotIndex(int inValue) { _slotIndex = inValue; }
@@ -71,7 +92,8 @@ namespace spine {
 	protected:
 		int _slotIndex;
 
-		Vector <Vector<float>> _vertices;
+		Vector <Vector<float>> _offsets;
+		Vector<size_t> _offsetStarts;
 
 		VertexAttachment *_attachment;
 	};
@@ -45,7 +45,7 @@ namespace spine {
 
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, int *searchCursor = NULL);
 
 		/// Sets the time and value of the specified keyframe.
 		/// @param drawOrder May be NULL to use bind pose draw order
@@ -47,7 +47,11 @@ namespace spine {
 
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction);
+			  MixDirection direction, int *searchCursor = NULL);
+
+		/// Adds the events after lastTime up to and including time to the events, the same events apply() adds. If lastTime
+		/// is greater than time, the events up to the end of the animation are added first, as for a loop.
+		void collectEvents(float lastTime, float time, Vector<Event *> &events, int *searchCursor = NULL);
 
 		/// Sets the time and value of the specified keyframe.
 		void setFrame(size_t frame, Event *event);
@@ -31,12 +31,17 @@
 #define Spine_MathUtil_h
 
 #include <spine/SpineObject.h>
+#include <spine/TrigMode.h>
 
 #include <string.h>
 // Needed for older MSVC versions
 #undef min
 #undef max
 
+#ifndef SPINE_DEFAULT_TRIG_MODE
+#define SPINE_DEFAULT_TRIG_MODE spine::TrigMode_Exact
+#endif
+
 namespace spine {
 
 	class SP_API MathUtil : public SpineObject {
@@ -61,20 +66,30 @@ namespace spine {
 
 		static float abs(float v);
 
-		/// Returns the sine in radians from a lookup table.
+		/// Selects how the trigonometric functions below are computed, trading precision for speed. The default is
+		/// SPINE_DEFAULT_TRIG_MODE, which is TrigMode_Exact unless defined otherwise at compile time. Set it before
+		/// skeletons are updated, it is shared by all threads.
+		static void setTrigMode(TrigMode mode);
+
+		static TrigMode getTrigMode();
+
+		/// Returns the sine of an angle in radians, computed as selected by the trig mode.
 		static float sin(float radians);
 
-		/// Returns the cosine in radians from a lookup table.
+		/// Returns the cosine of an angle in radians, computed as selected by the trig mode.
 		static float cos(float radians);
 
-		/// Returns the sine in radians from a lookup table.
+		/// Returns the sine of an angle in degrees, computed as selected by the trig mode.
 		static float sinDeg(float degrees);
 
-		/// Returns the cosine in radians from a lookup table.
+		/// Returns the cosine of an angle in degrees, computed as selected by the trig mode.
 		static float cosDeg(float degrees);
 
-		/// Returns atan2 in radians, faster but less accurate than Math.Atan2. Average error of 0.00231 radians (0.1323
-		/// degrees), largest error of 0.00488 radians (0.2796 degrees).
+		/// Computes the sine and cosine of count angles in degrees, as selected by the trig mode. With TrigMode_Polynomial
+		/// four angles are computed at a time using SSE or NEON. Gives the same results as sinDeg and cosDeg.
+		static void sinCosDeg(const float *degrees, float *outSine, float *outCosine, size_t count);
+
+		/// Returns atan2 in radians, computed as selected by the trig mode.
 		static float atan2(float y, float x);
 
 		static float acos(float v);
@@ -36,10 +36,12 @@
 #include <spine/SpineObject.h>
 
 namespace spine {
+	/// Keeps freed objects to be reused by obtain(). Free objects are kept on a stack, so obtain() and free() take constant
+	/// time, and reused objects keep their state, such as the capacity of their vectors.
 	template<typename T>
 	class SP_API Pool : public SpineObject {
 	public:
-		Pool() {
+		Pool() : _inUse(0), _peakInUse(0) {
 		}
 
 		~Pool() {
@@ -47,27 +49,50 @@ namespace spine {
 		}
 
 		T *obtain() {
+			T *ret;
 			if (_objects.size() > 0) {
-				T **object = &_objects[_objects.size() - 1];
-				T *ret = *object;
+				ret = _objects[_objects.size() - 1];
 				_objects.removeAt(_objects.size() - 1);
-
-				return ret;
 			} else {
-				T *ret = new(__FILE__, __LINE__) T();
-
-				return ret;
+				ret = new(__FILE__, __LINE__) T();
 			}
+			if (++_inUse > _peakInUse) _peakInUse = _inUse;
+			return ret;
 		}
 
+		/// The object must not be freed again before it is obtained. Debug builds assert this.
 		void free(T *object) {
-			if (!_objects.contains(object)) {
-				_objects.add(object);
-			}
+			assert(!_objects.contains(object));
+			_objects.add(object);
+			if (_inUse > 0) _inUse--;
+		}
+
+		/// Creates objects until there are at least the specified number of free objects.
+		void preallocate(size_t count) {
+			_objects.ensureCapacity(count);
+			while (_objects.size() < count)
+				_objects.add(new(__FILE__, __LINE__) T());
+		}
+
+		/// The number of objects ready to be obtained without creating new ones.
+		size_t getFreeCount() {
+			return _objects.size();
+		}
+
+		/// The number of objects obtained and not freed.
+		size_t getInUseCount() {
+			return _inUse;
+		}
+
+		/// The most objects in use at once, which can be passed to preallocate().
+		size_t getPeakInUseCount() {
+			return _peakInUse;
 		}
 
 	private:
 		Vector<T *> _objects;
+		size_t _inUse;
+		size_t _peakInUse;
 	};
 }
 
@@ -0,0 +1,107 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+#ifndef Spine_PoseBuffer_h
+#define Spine_PoseBuffer_h
+
+#include <spine/Vector.h>
+
+namespace spine {
+	class Skeleton;
+
+	class Attachment;
+
+	/// A pose detached from any skeleton: the local bone transforms, slot colors, attachments, sequence indices and deforms,
+	/// the draw order and the constraint mixes, which are all the values AnimationState::apply() writes.
+	///
+	/// A pose is captured from a skeleton and committed to another skeleton of the same SkeletonData. This allows the
+	/// animations of a skeleton to be applied to a private copy, for example one made with Skeleton::clone(), on any
+	/// thread, and the result to be committed to the displayed skeleton in one pass. Captured poses can also be cached and
+	/// blended with each other without applying any timelines.
+	class SP_API PoseBuffer : public SpineObject {
+	public:
+		PoseBuffer();
+
+		~PoseBuffer();
+
+		/// Copies the pose of the skeleton into this pose buffer.
+		void capture(Skeleton &skeleton);
+
+		/// Sets the pose of the skeleton, which must have the same SkeletonData as the captured skeleton.
+		void commit(Skeleton &skeleton);
+
+		/// Copies a pose buffer.
+		void set(PoseBuffer &pose);
+
+		/// Mixes this pose toward another pose captured from a skeleton of the same SkeletonData. Rotations take the shortest
+		/// route. Deforms of the same length are mixed, other deforms and all discrete values, such as attachments and the
+		/// draw order, are taken from the other pose when alpha is greater than 0, as AnimationState does for a mix with
+		/// the default thresholds.
+		void blend(PoseBuffer &to, float alpha);
+
+		size_t getBoneCount();
+
+		size_t getSlotCount();
+
+		/// The local transforms of all bones, as the PoseChannel_X to PoseChannel_ShearY channels with the SkeletonPose
+		/// stride.
+		Vector<float> &getBoneValues();
+
+		/// The color and dark color of all slots, as seven channels of red, green, blue, alpha and dark red, green and blue.
+		/// Each channel is indexed by slot index, with the stride rounded up to a multiple of 4.
+		Vector<float> &getSlotColors();
+
+		Vector<Attachment *> &getAttachments();
+
+		/// The slot indices in draw order.
+		Vector<int> &getDrawOrder();
+
+	private:
+		size_t _boneCount;
+		size_t _boneStride;
+		size_t _slotCount;
+		size_t _slotStride;
+		Vector<float> _boneValues;
+		Vector<float> _slotColors;
+		Vector<Attachment *> _attachments;
+		Vector<int> _sequenceIndices;
+		Vector<Vector<float>> _deforms;
+		Vector<int> _drawOrder;
+		/// Mix and softness for each IK constraint, the six mixes for each transform constraint, then position, spacing and
+		/// the three mixes for each path constraint.
+		Vector<float> _constraintValues;
+		/// Bend direction, compress and stretch for each IK constraint.
+		Vector<int> _ikValues;
+
+		PoseBuffer(const PoseBuffer &);
+
+		PoseBuffer &operator=(const PoseBuffer &);
+	};
+}
+
+#endif /* Spine_PoseBuffer_h */
@@ -35,6 +35,8 @@
 #include <spine/SpineObject.h>
 #include <spine/SpineString.h>
 #include <spine/Color.h>
+#include <spine/SkeletonPose.h>
+#include <spine/UpdateInstruction.h>
 
 namespace spine {
 	class SkeletonData;
@@ -55,9 +57,17 @@ namespace spine {
 
 	class Attachment;
 
+	class SkeletonUpdateOrder;
+
+	class TaskRunner;
+
 	class SP_API Skeleton : public SpineObject {
 		friend class AnimationState;
 
+		friend class SkeletonData;
+
+		friend class SkeletonInstanceBatch;
+
 		friend class SkeletonBounds;
 
 		friend class SkeletonClipping;
@@ -117,17 +127,59 @@ namespace spine {
 
 		~Skeleton();
 
+		/// Creates a skeleton with the same skeleton data, skin, pose, draw order, slot state and constraint mixes as this
+		/// skeleton. Bones, slots and constraints are matched by index and the pose is copied in one block, so no names are
+		/// looked up and no setup pose is applied. Cheaper than creating a skeleton from SkeletonData and posing it, which
+		/// makes a skeleton in the setup pose a good prototype for spawning many instances.
+		Skeleton *clone();
+
 		/// Caches information about bones and constraints. Must be called if bones, constraints or weighted path attachments are added
 		/// or removed.
+		///
+		/// The computed order is memoized on the SkeletonData, keyed by the bones and constraints of the skin and the bones
+		/// of every path attachment the path constraints may use, from this skin, the default skin, the data's skins and
+		/// the target slots. Setting a skin used before, or creating another skeleton with the same skin, copies the order
+		/// instead of sorting again. Skeletons sharing SkeletonData may call it on different threads, the memo is locked.
 		void updateCache();
 
 		void printUpdateCache();
 
+		/// Prints the update program compiled by updateCache(), one instruction per line.
+		void printUpdateProgram();
+
 		/// Updates the world transform for each bone and applies constraints.
 		void updateWorldTransform();
 
 		void updateWorldTransform(Bone *parent);
 
+		/// When enabled, updateWorldTransform() only recomputes bones whose local transform changed since the last update,
+		/// bones constrained by an active constraint, and the descendants of both. Other bones keep their world transform,
+		/// so world transforms changed directly by application code are not reset for them. Changing the skeleton's
+		/// position or scale, updateCache() and updateWorldTransform(Bone *) cause the next update to recompute every bone.
+		void setIncrementalUpdate(bool inValue);
+
+		bool isIncrementalUpdate();
+
+		/// When set, updateWorldTransform() splits the update cache into branches of bones that share no constraints and
+		/// runs them in parallel with the task runner, returning once all are done. Only used without incremental updates,
+		/// when there are no path constraints or custom updatables, and when there are at least two branches of
+		/// getParallelBranchSize() update cache entries. May be NULL, the default, to update on the calling thread.
+		void setTaskRunner(TaskRunner *inValue);
+
+		TaskRunner *getTaskRunner();
+
+		/// The fewest update cache entries worth running as a separate branch with the task runner. Smaller subtrees are
+		/// packed together. Default is DefaultParallelBranchSize, runtime/tests/TaskRunnerBenchmark measures the
+		/// crossover for a platform and task runner.
+		void setParallelBranchSize(size_t inValue);
+
+		size_t getParallelBranchSize();
+
+		/// A branch must cost more to update than waking the task runner's threads. In a release build a
+		/// ThreadPoolTaskRunner run() costs about as much as updating 85 to 145 entries, this leaves a margin for that cost
+		/// varying between platforms.
+		static const size_t DefaultParallelBranchSize = 256;
+
 		/// Sets the bones, constraints, and slots to their setup pose values.
 		void setToSetupPose();
 
@@ -186,8 +238,19 @@ namespace spine {
 
 		Vector<Bone *> &getBones();
 
+		/// The structure-of-arrays storage backing the transforms of all bones, indexed by bone index.
+		SkeletonPose &getPose();
+
 		Vector<Updatable *> &getUpdateCacheList();
 
+		/// The update program compiled from the update cache by updateCache(). If the update cache list is changed without
+		/// calling updateCache(), the update cache is used directly.
+		Vector<UpdateInstruction> &getUpdateProgram();
+
+		/// The runs of bones the UpdateOp_NormalRun instructions of the update program refer to, followed by those of the
+		/// parallel branches, if any.
+		Vector<NormalBoneRun> &getNormalRuns();
+
 		Vector<Slot *> &getSlots();
 
 		Vector<Slot *> &getDrawOrder();
@@ -222,6 +285,10 @@ namespace spine {
 
 	private:
 		SkeletonData *_data;
+		SkeletonPose _pose;
+		// One block holding the bones, slots and constraints, filled in that order.
+		char *_objects;
+		size_t _objectsUsed;
 		Vector<Bone *> _bones;
 		Vector<Slot *> _slots;
 		Vector<Slot *> _drawOrder;
@@ -229,11 +296,44 @@ namespace spine {
 		Vector<TransformConstraint *> _transformConstraints;
 		Vector<PathConstraint *> _pathConstraints;
 		Vector<Updatable *> _updateCache;
+		Vector<const void *> _updateOrderKey;
+		size_t _updateOrderId; // See SkeletonUpdateOrder::_id, 0 before the update cache is built.
+		Vector<UpdateInstruction> _updateProgram;
+		size_t _programCacheSize;
+		size_t _programRunCount; // The runs of _updateProgram, the branches' runs follow them.
+		TaskRunner *_taskRunner;
+		size_t _parallelBranchSize;
+		bool _branchesValid;
+		// The root bone's instructions, then one program per independent branch.
+		Vector<UpdateInstruction> _branchProgram;
+		Vector<size_t> _branchStarts;
+		Vector<NormalBoneRun> _normalRuns;
+		Vector<int> _runBones;
+		Vector<int> _runParents;
+		Vector<size_t> _runLevelEnds;
+		Vector<bool> _constrainedBones;
+		Vector<bool> _dirtyBones;
+		Vector<int> _dirtyRunBones;
+		Vector<int> _dirtyRunParents;
+		Vector<size_t> _dirtyLevelEnds;
+		Vector<float> _lastLocal;
+		bool _incrementalUpdate;
+		bool _lastLocalValid;
+		float _lastX, _lastY, _lastScaleX, _lastScaleY;
 		Skin *_skin;
 		Color _color;
 		float _scaleX, _scaleY;
 		float _x, _y;
 
+		explicit Skeleton(Skeleton &prototype);
+
+		void allocateObjects();
+
+		void *nextObject(size_t size);
+
+		template<typename T>
+		static void destroyObjects(Vector<T *> &objects);
+
 		void sortIkConstraint(IkConstraint *constraint);
 
 		void sortPathConstraint(PathConstraint *constraint);
@@ -247,6 +347,43 @@ namespace spine {
 		void sortBone(Bone *bone);
 
 		static void sortReset(Vector<Bone *> &bones);
+
+		void buildUpdateOrderKey();
+
+		void addUpdateOrderKey(Attachment *attachment);
+
+		void addUpdateOrderKey(Skin *skin, size_t slotIndex);
+
+		SkeletonUpdateOrder *saveUpdateOrder(size_t hash);
+
+		void loadUpdateOrder(SkeletonUpdateOrder &order);
+
+		void compileUpdateProgram();
+
+		void appendUpdateProgram(Updatable **entries, size_t count, Vector<UpdateInstruction> &program);
+
+		void addNormalRun(Updatable **entries, size_t count, int maxLevel, Vector<int> &levels,
+						  Vector<UpdateInstruction> &program);
+
+		void buildDirtyTracking();
+
+		void markChangedBones();
+
+		void saveLocalPose();
+
+		void runUpdateProgram(int skipBone, bool incremental);
+
+		void runInstructions(const UpdateInstruction *program, size_t count, int skipBone, bool incremental);
+
+		void compileBranches();
+
+		static int findComponent(Vector<int> &components, int bone);
+
+		void runBranches();
+
+		static void runBranch(void *context, size_t index);
+
+		void updateDirtyRun(NormalBoneRun &run);
 	};
 }
 
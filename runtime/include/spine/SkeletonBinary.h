@@ -106,6 +106,17 @@ namespace spine {
 
 		void setScale(float scale) { _scale = scale; }
 
+		/// Removes keyframes of rotate, shear and translate timelines that interpolating between the keyframes around them
+		/// reproduces within the tolerance, in degrees for rotate and shear and in scaled skeleton units for translate. A
+		/// negative tolerance, the default, keeps all keyframes of those timelines.
+		void setRedundantFrameTolerance(float rotateTolerance, float translateTolerance) {
+			_rotateTolerance = rotateTolerance;
+			_translateTolerance = translateTolerance;
+		}
+
+		/// The number of keyframes removed by the redundant frame tolerance while reading the last skeleton data.
+		int getRemovedFrameCount() { return _removedFrames; }
+
 		String &getError() { return _error; }
 
 	private:
@@ -118,6 +129,8 @@ namespace spine {
 		Vector<LinkedMesh *> _linkedMeshes;
 		String _error;
 		float _scale;
+		float _rotateTolerance, _translateTolerance;
+		int _removedFrames;
 		const bool _ownsLoader;
 
 		void setError(const char *value1, const char *value2);
@@ -32,6 +32,7 @@
 
 #include <spine/Vector.h>
 #include <spine/SpineString.h>
+#include <spine/Property.h>
 
 namespace spine {
 	class BoneData;
@@ -50,6 +51,8 @@ namespace spine {
 
 	class PathConstraintData;
 
+	class Skeleton;
+
 /// Stores the setup pose and all of the stateless data for a skeleton.
 	class SP_API SkeletonData : public SpineObject {
 		friend class SkeletonBinary;
@@ -58,6 +61,8 @@ namespace spine {
 
 		friend class Skeleton;
 
+		friend class Animation;
+
 	public:
 		SkeletonData();
 
@@ -118,6 +123,13 @@ namespace spine {
 
 		Vector<PathConstraintData *> &getPathConstraints();
 
+		/// The dense index of a timeline property ID, shared by the animations of this skeleton data. IDs that aren't
+		/// indexed yet are given the next index. Thread safe. See Animation::indexProperties().
+		int getPropertyIndex(PropertyId id);
+
+		/// The number of property IDs given an index by getPropertyIndex().
+		size_t getPropertyCount();
+
 		float getX();
 
 		void setX(float inValue);
@@ -156,6 +168,12 @@ namespace spine {
 
 		void setFps(float inValue);
 
+		/// The number of update orders memoized for the skeletons using this data, so skeletons with an equivalent skin
+		/// don't sort their bones and constraints again. 0 disables memoization. Default is 64.
+		size_t getUpdateOrderCacheSize();
+
+		void setUpdateOrderCacheSize(size_t inValue);
+
 	private:
 		String _name;
 		Vector<BoneData *> _bones; // Ordered parents first
@@ -171,11 +189,34 @@ namespace spine {
 		String _version;
 		String _hash;
 		Vector<char *> _strings;
+		struct UpdateOrderCache;
+		/// Update orders memoized by Skeleton::updateCache(), guarded by a lock since skeletons sharing this data may be
+		/// created or change skins on different threads.
+		UpdateOrderCache *_updateOrderCache;
+		struct PropertyIndices;
+		/// The dense index of each property ID, guarded by a lock since animations created at runtime are indexed when
+		/// animation states first apply them, possibly on different threads.
+		PropertyIndices *_propertyIndices;
 
 		// Nonessential.
 		float _fps;
 		String _imagesPath;
 		String _audioPath;
+
+		/// Indexes the properties of the animation unless it is indexed for this skeleton data, under the lock.
+		void indexProperties(Animation &animation);
+
+		/// Loads the memoized update order matching the skeleton's update order key into the skeleton.
+		/// @return False if there is none.
+		bool findUpdateOrder(Skeleton &skeleton, size_t hash);
+
+		/// Gives the skeleton's update order an id, memoizing it unless an equal order was added meanwhile, in which case
+		/// the skeleton takes that order's id. The oldest order is replaced when the cache is full.
+		void addUpdateOrder(Skeleton &skeleton, size_t hash);
+
+		SkeletonData(const SkeletonData &);
+
+		SkeletonData &operator=(const SkeletonData &);
 	};
 }
 
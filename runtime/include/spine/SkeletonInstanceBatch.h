@@ -0,0 +1,73 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SkeletonInstanceBatch_h
+#define Spine_SkeletonInstanceBatch_h
+
+#include <spine/Vector.h>
+
+namespace spine {
+	class Skeleton;
+
+	class SkeletonPose;
+
+	/// Updates the world transforms of many skeletons in lockstep.
+	///
+	/// Skeletons of the same SkeletonData with the same update order, which is the case when they use the same skin, are
+	/// stepped through their shared update program a few at a time: each step runs for all skeletons of the tile before
+	/// the next step. Bone data and indices are then read once per tile instead of once per skeleton, and runs of
+	/// TransformMode_Normal bones are computed across instances by BoneKernel::updateNormalInstances(). World transforms are
+	/// the same as from Skeleton::updateWorldTransform().
+	class SP_API SkeletonInstanceBatch : public SpineObject {
+	public:
+		SkeletonInstanceBatch();
+
+		~SkeletonInstanceBatch();
+
+		/// Same as calling Skeleton::updateWorldTransform() on each skeleton. Skeletons using incremental updates, or whose
+		/// update cache was changed without Skeleton::updateCache(), are updated one by one.
+		void updateWorldTransform(Skeleton **skeletons, size_t count);
+
+		void updateWorldTransform(Vector<Skeleton *> &skeletons);
+
+	private:
+		/// The number of skeletons stepped through the program together. Larger tiles no longer fit their poses in cache.
+		static const size_t TileSize = 4;
+
+		Vector<Skeleton *> _pending;
+		Vector<Skeleton *> _group;
+		Vector<SkeletonPose *> _poses;
+
+		void updateGroup();
+
+		void updateTile(Skeleton **group, size_t count);
+	};
+}
+
+#endif /* Spine_SkeletonInstanceBatch_h */
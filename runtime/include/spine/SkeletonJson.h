@@ -75,12 +75,25 @@ namespace spine {
 
 		void setScale(float scale) { _scale = scale; }
 
+		/// Removes keyframes of rotate, shear and translate timelines that interpolating between the keyframes around them
+		/// reproduces within the tolerance, in degrees for rotate and shear and in scaled skeleton units for translate. A
+		/// negative tolerance, the default, keeps all keyframes of those timelines.
+		void setRedundantFrameTolerance(float rotateTolerance, float translateTolerance) {
+			_rotateTolerance = rotateTolerance;
+			_translateTolerance = translateTolerance;
+		}
+
+		/// The number of keyframes removed by the redundant frame tolerance while reading the last skeleton data.
+		int getRemovedFrameCount() { return _removedFrames; }
+
 		String &getError() { return _error; }
 
 	private:
 		AttachmentLoader *_attachmentLoader;
 		Vector<LinkedMesh *> _linkedMeshes;
 		float _scale;
+		float _rotateTolerance, _translateTolerance;
+		int _removedFrames;
 		const bool _ownsLoader;
 		String _error;
 
@@ -0,0 +1,73 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SkeletonPose_h
+#define Spine_SkeletonPose_h
+
+#include <spine/PoseChannel.h>
+#include <spine/SpineObject.h>
+
+namespace spine {
+	/// Structure-of-arrays storage for the local, applied and world transforms of all bones of a skeleton.
+	///
+	/// Each PoseChannel is a contiguous float array indexed by bone index. A Bone reads and writes its values here through
+	/// its index, so the Bone API keeps working while per frame passes can sweep the arrays linearly.
+	class SP_API SkeletonPose : public SpineObject {
+	public:
+		explicit SkeletonPose(size_t boneCount);
+
+		~SkeletonPose();
+
+		size_t getBoneCount();
+
+		/// The number of floats between the start of two consecutive channels. Always a multiple of 4 so every channel
+		/// has the same alignment as the first.
+		size_t getStride();
+
+		/// @return The values of the channel for all bones, indexed by bone index.
+		float *getChannel(PoseChannel channel) { return _buffer + channel * _stride; }
+
+		/// Copies the local transform of every bone to its applied transform.
+		void resetAppliedTransforms();
+
+		/// Copies all channels of a pose with the same bone count.
+		void set(SkeletonPose &pose);
+
+	private:
+		size_t _boneCount;
+		size_t _stride;
+		float *_buffer;
+
+		SkeletonPose(const SkeletonPose &);
+
+		SkeletonPose &operator=(const SkeletonPose &);
+	};
+}
+
+#endif /* Spine_SkeletonPose_h */
@@ -0,0 +1,78 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SkeletonUpdateOrder_h
+#define Spine_SkeletonUpdateOrder_h
+
+#include <spine/UpdateInstruction.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	/// The update order Skeleton::updateCache() computed for one skin, memoized on SkeletonData so other skeletons using an
+	/// equivalent skin copy it instead of sorting the bones and constraints again.
+	///
+	/// An order is found by a key describing everything the sort depends on besides the SkeletonData: the bones and
+	/// constraints of the skin, and the bones of the path attachments path constraints may use. The key holds no
+	/// attachment or skin pointers, so skins with the same content share an order, a skin changed after its order was
+	/// cached simply gets a new one, and a deleted skin leaves no entry that a new object at the same address could match.
+	class SP_API SkeletonUpdateOrder : public SpineObject {
+		friend class Skeleton;
+
+		friend class SkeletonData;
+
+	public:
+		SkeletonUpdateOrder(Vector<const void *> &key, size_t hash, size_t id);
+
+		~SkeletonUpdateOrder();
+
+		/// @return The hash of a key, for matches().
+		static size_t hashKey(Vector<const void *> &key);
+
+		bool matches(Vector<const void *> &key, size_t hash);
+
+	private:
+		Vector<const void *> _key;
+		size_t _hash;
+		/// Unique for the SkeletonData, also once the order is evicted. Skeletons with the same id share the update order.
+		size_t _id;
+		SkeletonUpdateOrder *_nextInBucket;
+		/// The update cache, with UpdateOp_Bone, UpdateOp_IkConstraint, UpdateOp_TransformConstraint and
+		/// UpdateOp_PathConstraint entries.
+		Vector<UpdateInstruction> _updateCache;
+		/// Active flags of the bones, then the IK, transform and path constraints.
+		Vector<bool> _active;
+		Vector<UpdateInstruction> _updateProgram;
+		Vector<NormalBoneRun> _normalRuns;
+		Vector<int> _runBones;
+		Vector<int> _runParents;
+		Vector<size_t> _runLevelEnds;
+	};
+}
+
+#endif /* Spine_SkeletonUpdateOrder_h */
@@ -131,6 +131,9 @@ namespace spine {
 		int _attachmentState;
 		int _sequenceIndex;
 		Vector<float> _deform;
+
+		/// Copies the state of the same slot of another skeleton.
+		Slot(Slot &prototype, Bone &bone);
 	};
 }
 
@@ -0,0 +1,71 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_TaskRunner_h
+#define Spine_TaskRunner_h
+
+#include <spine/SpineObject.h>
+
+namespace spine {
+	/// Runs batches of independent tasks, used by Skeleton::updateWorldTransform() to update independent bone subtrees in
+	/// parallel. Implement this to run the tasks on an engine's job system.
+	class SP_API TaskRunner : public SpineObject {
+	public:
+		typedef void (*Task)(void *context, size_t index);
+
+		virtual ~TaskRunner();
+
+		/// Calls the task with every index from 0 to count - 1, possibly in parallel, and returns once all calls are done.
+		virtual void run(Task task, void *context, size_t count) = 0;
+	};
+
+	/// A TaskRunner with its own worker threads. The thread calling run() works on the tasks too. run() is not reentrant:
+	/// a runner shared by skeletons updated on different threads must not have run() called by two threads at once, use
+	/// one runner per thread or a job system's TaskRunner instead. Tasks must not call run() of the same runner.
+	class SP_API ThreadPoolTaskRunner : public TaskRunner {
+	public:
+		/// @param threadCount The number of worker threads to start, besides the calling thread.
+		explicit ThreadPoolTaskRunner(int threadCount);
+
+		virtual ~ThreadPoolTaskRunner();
+
+		virtual void run(Task task, void *context, size_t count);
+
+	private:
+		struct Workers;
+
+		Workers *_workers;
+
+		ThreadPoolTaskRunner(const ThreadPoolTaskRunner &);
+
+		ThreadPoolTaskRunner &operator=(const ThreadPoolTaskRunner &);
+	};
+}
+
+#endif /* Spine_TaskRunner_h */
@@ -62,7 +62,7 @@ namespace spine {
 		/// @param direction Indicates whether the timeline is mixing in or out. Used by timelines which perform instant transitions such as DrawOrderTimeline and AttachmentTimeline.
 		virtual void
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
-			  MixDirection direction) = 0;
+			  MixDirection direction, int *searchCursor = NULL) = 0;
 
 		size_t getFrameEntries();
 
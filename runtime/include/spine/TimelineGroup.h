@@ -0,0 +1,89 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_TimelineGroup_h
+#define Spine_TimelineGroup_h
+
+#include <spine/MixBlend.h>
+#include <spine/PoseChannel.h>
+#include <spine/RTTI.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	class CurveTimeline;
+
+	class Skeleton;
+
+	class Timeline;
+
+	/// Timelines of one type that key bone values which are offsets from the setup pose: rotate, translate and shear.
+	///
+	/// Created by Animation::groupTimelines(). The timelines are applied in one loop that writes the SkeletonPose channels
+	/// directly, with the same results as calling Timeline::apply() on each of them. No other timeline reads these values,
+	/// so applying them apart from the animation's other timelines doesn't change the pose. When all timelines have the
+	/// same frame times, as baked animations do, the frame is searched once for the whole group.
+	class SP_API TimelineGroup : public SpineObject {
+		friend class Animation;
+
+	public:
+		~TimelineGroup();
+
+		/// Applies all timelines of the group like Timeline::apply() with MixDirection_In.
+		/// @param cursors The search cursor of each timeline of the animation, indexed by the timeline's index, or NULL.
+		void apply(Skeleton &skeleton, float time, float alpha, MixBlend blend, int *cursors);
+
+		/// Returns true if the timeline can be part of a group.
+		static bool isGroupable(Timeline *timeline);
+
+		const RTTI &getType();
+
+		Vector<CurveTimeline *> &getTimelines();
+
+		/// The index of each timeline in the animation.
+		Vector<int> &getTimelineIndices();
+
+		/// Returns true if all timelines have the same frame times.
+		bool hasSharedFrames();
+
+	private:
+		const RTTI &_type;
+		PoseChannel _channel1, _channel2;
+		bool _rotate;
+		bool _sharedFrames;
+		Vector<CurveTimeline *> _timelines;
+		Vector<int> _timelineIndices;
+		Vector<int> _boneIndices;
+
+		explicit TimelineGroup(Timeline *timeline);
+
+		void add(Timeline *timeline, int timelineIndex);
+	};
+}
+
+#endif /* Spine_TimelineGroup_h */
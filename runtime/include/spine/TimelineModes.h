@@ -0,0 +1,73 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_TimelineModes_h
+#define Spine_TimelineModes_h
+
+#include <spine/Vector.h>
+
+namespace spine {
+	/// The timeline modes AnimationState computed for one track layout, memoized on AnimationStateData so animation states
+	/// going through the same transitions copy them instead of computing them again.
+	///
+	/// A layout is found by a key describing everything the modes depend on: for each track, the IDs of the animations
+	/// from the oldest mixing entry to the current one, each with the hold previous, additive and mix duration flags the modes are
+	/// computed from.
+	class SP_API TimelineModes : public SpineObject {
+		friend class AnimationState;
+
+		friend class AnimationStateData;
+
+	public:
+		TimelineModes();
+
+		~TimelineModes();
+
+		/// @return The hash of a key, for matches().
+		static size_t hashKey(Vector<const void *> &key);
+
+		bool matches(Vector<const void *> &key, size_t hash);
+
+		/// Copies the key and modes of the other timeline modes.
+		void set(TimelineModes &modes);
+
+	private:
+		Vector<const void *> _key;
+		size_t _hash;
+		/// The timeline modes of each entry the modes are computed for, in the order they are computed.
+		Vector<int> _modes;
+		/// For each of _modes, the number of mixing to steps from the entry to its hold mix entry, or 0 for none.
+		Vector<int> _holdMixes;
+		/// The number of timelines of each entry and a hash of their property IDs, checked before the modes are used.
+		Vector<int> _timelineCounts;
+		Vector<size_t> _propertyHashes;
+	};
+}
+
+#endif /* Spine_TimelineModes_h */
@@ -0,0 +1,73 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_UpdateInstruction_h
+#define Spine_UpdateInstruction_h
+
+#include <spine/TransformMode.h>
+#include <spine/dll.h>
+
+#include <stddef.h>
+
+namespace spine {
+	/// The operation of an UpdateInstruction.
+	enum UpdateOp {
+		/// Updates the bone at index with Bone::updateWorldTransform, using the bone's transform mode.
+		UpdateOp_Bone = 0,
+		/// Updates a run of non-root TransformMode_Normal bones with BoneKernel. The index is the run's index.
+		UpdateOp_NormalRun,
+		/// Applies the IK constraint at index in Skeleton::getIkConstraints().
+		UpdateOp_IkConstraint,
+		/// Applies the transform constraint at index in Skeleton::getTransformConstraints().
+		UpdateOp_TransformConstraint,
+		/// Applies the path constraint at index in Skeleton::getPathConstraints().
+		UpdateOp_PathConstraint,
+		/// Calls Updatable::update() on the update cache entry at index, for updatables of other types.
+		UpdateOp_Updatable
+	};
+
+	/// An instruction of the update program Skeleton::updateCache() compiles from the update cache. The program is executed by
+	/// Skeleton::updateWorldTransform() without virtual calls for bones and constraints.
+	struct SP_API UpdateInstruction {
+		UpdateOp op;
+		/// For UpdateOp_Bone, the bone's transform mode. TransformMode_Normal otherwise.
+		TransformMode mode;
+		int index;
+	};
+
+	/// A run of consecutive update cache entries which are all non-root TransformMode_Normal bones, executed by an
+	/// UpdateOp_NormalRun. The bones are grouped into levels, where no bone depends on another bone of the same level, so
+	/// each level can be updated by BoneKernel.
+	struct SP_API NormalBoneRun {
+		size_t firstBone;
+		size_t firstLevel, lastLevel;
+	};
+}
+
+#endif /* Spine_UpdateInstruction_h */
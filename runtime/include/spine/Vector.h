@@ -94,6 +94,19 @@ namespace spine {
 			_buffer = SpineExtension::realloc<T>(_buffer, newCapacity, __FILE__, __LINE__);
 		}
 
+		/// Releases the capacity beyond the current size.
+		inline void shrinkToFit() {
+			if (_capacity == _size) return;
+			if (_size == 0) {
+				deallocate(_buffer);
+				_buffer = NULL;
+				_capacity = 0;
+				return;
+			}
+			_capacity = _size;
+			_buffer = SpineExtension::realloc<T>(_buffer, _capacity, __FILE__, __LINE__);
+		}
+
 		inline void add(const T &inValue) {
 			if (_size == _capacity) {
 				// inValue might reference an element in this buffer
@@ -31,6 +31,7 @@
 #define SPINE_SPINE_H_
 
 #include <spine/Animation.h>
+#include <spine/AnimationBaker.h>
 #include <spine/AnimationState.h>
 #include <spine/AnimationStateData.h>
 #include <spine/Atlas.h>
@@ -39,9 +40,11 @@
 #include <spine/AttachmentLoader.h>
 #include <spine/AttachmentTimeline.h>
 #include <spine/AttachmentType.h>
+#include <spine/BakedAnimation.h>
 #include <spine/BlendMode.h>
 #include <spine/Bone.h>
 #include <spine/BoneData.h>
+#include <spine/BoneKernel.h>
 #include <spine/BoundingBoxAttachment.h>
 #include <spine/ClippingAttachment.h>
 #include <spine/Color.h>
@@ -73,6 +76,8 @@
 #include <spine/PathConstraintPositionTimeline.h>
 #include <spine/PathConstraintSpacingTimeline.h>
 #include <spine/PointAttachment.h>
+#include <spine/PoseBuffer.h>
+#include <spine/PoseChannel.h>
 #include <spine/Pool.h>
 #include <spine/PositionMode.h>
 #include <spine/RegionAttachment.h>
@@ -86,15 +91,21 @@
 #include <spine/SkeletonBounds.h>
 #include <spine/SkeletonClipping.h>
 #include <spine/SkeletonData.h>
+#include <spine/SkeletonInstanceBatch.h>
 #include <spine/SkeletonJson.h>
+#include <spine/SkeletonPose.h>
+#include <spine/SkeletonUpdateOrder.h>
 #include <spine/Skin.h>
 #include <spine/Slot.h>
 #include <spine/SlotData.h>
 #include <spine/SpacingMode.h>
 #include <spine/SpineObject.h>
 #include <spine/SpineString.h>
+#include <spine/TaskRunner.h>
 #include <spine/TextureLoader.h>
 #include <spine/Timeline.h>
+#include <spine/TimelineGroup.h>
+#include <spine/TimelineModes.h>
 #include <spine/Property.h>
 #include <spine/TransformConstraint.h>
 #include <spine/TransformConstraintData.h>
@@ -102,7 +113,9 @@
 #include <spine/TransformMode.h>
 #include <spine/TranslateTimeline.h>
 #include <spine/Triangulator.h>
+#include <spine/TrigMode.h>
 #include <spine/Updatable.h>
+#include <spine/UpdateInstruction.h>
 #include <spine/Vector.h>
 #include <spine/VertexAttachment.h>
 #include <spine/Vertices.h>
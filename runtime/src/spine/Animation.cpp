@@ -29,36 +29,101 @@
 
 #include <spine/Animation.h>
 #include <spine/Event.h>
+#include <spine/EventTimeline.h>
 #include <spine/Skeleton.h>
+#include <spine/SkeletonData.h>
 #include <spine/Timeline.h>
+#include <spine/TimelineGroup.h>
 
 #include <spine/ContainerUtil.h>
 
+#include <algorithm>
+#include <atomic>
 #include <stdint.h>
 
 using namespace spine;
 
-Animation::Animation(const String &name, Vector<Timeline *> &timelines, float duration) : _timelines(timelines),
-																						  _timelineIds(),
+static std::atomic<size_t> nextAnimationId(1);
+
+Animation::Animation(const String &name, Vector<Timeline *> &timelines, float duration) : _id(nextAnimationId++),
+																						  _propertyHash(2166136261u),
+																						  _timelines(timelines),
+																						  _propertyIndexData(NULL),
 																						  _duration(duration),
 																						  _name(name) {
 	assert(_name.length() > 0);
 	for (size_t i = 0; i < timelines.size(); i++) {
-		Vector<PropertyId> propertyIds = timelines[i]->getPropertyIds();
-		for (size_t ii = 0; ii < propertyIds.size(); ii++)
-			_timelineIds.put(propertyIds[ii], true);
+		Vector<PropertyId> &propertyIds = timelines[i]->getPropertyIds();
+		for (size_t ii = 0; ii < propertyIds.size(); ii++) {
+			_timelineIds.add(propertyIds[ii]);
+			_propertyHash = (_propertyHash ^ (size_t) propertyIds[ii]) * 16777619u;
+		}
+		_propertyHash = (_propertyHash ^ i) * 16777619u;
+		if (timelines[i]->getRTTI().isExactly(EventTimeline::rtti))
+			_eventTimelines.add(static_cast<EventTimeline *>(timelines[i]));
 	}
+	// Sort once and drop duplicates, for hasTimeline().
+	PropertyId *ids = _timelineIds.buffer();
+	std::sort(ids, ids + _timelineIds.size());
+	_timelineIds.setSize(std::unique(ids, ids + _timelineIds.size()) - ids, 0);
+}
+
+size_t Animation::getId() {
+	return _id;
 }
 
 bool Animation::hasTimeline(Vector<PropertyId> &ids) {
+	PropertyId *timelineIds = _timelineIds.buffer();
 	for (size_t i = 0; i < ids.size(); i++) {
-		if (_timelineIds.containsKey(ids[i])) return true;
+		if (std::binary_search(timelineIds, timelineIds + _timelineIds.size(), ids[i])) return true;
+	}
+	return false;
+}
+
+void Animation::indexProperties(SkeletonData &skeletonData) {
+	skeletonData.indexProperties(*this);
+}
+
+bool Animation::hasProperties(Animation &animation, size_t timelineIndex) {
+	size_t wordCount = _propertyBits.size();
+	for (int i = animation._propertyStarts[timelineIndex], n = animation._propertyStarts[timelineIndex + 1]; i < n; i++) {
+		int index = animation._propertyIndices[i];
+		size_t word = (size_t) index >> 5;
+		if (word < wordCount && (_propertyBits[word] & (1u << (index & 31)))) return true;
 	}
 	return false;
 }
 
 Animation::~Animation() {
 	ContainerUtil::cleanUpVectorOfPointers(_timelines);
+	ContainerUtil::cleanUpVectorOfPointers(_timelineGroups);
+}
+
+void Animation::groupTimelines() {
+	if (_timelineGroups.size() > 0) return;
+	for (size_t i = 0, n = _timelines.size(); i < n; i++) {
+		Timeline *timeline = _timelines[i];
+		if (!TimelineGroup::isGroupable(timeline)) {
+			_ungroupedTimelines.add((int) i);
+			continue;
+		}
+		TimelineGroup *group = NULL;
+		for (size_t ii = 0; ii < _timelineGroups.size(); ii++) {
+			if (_timelineGroups[ii]->getType().isExactly(timeline->getRTTI())) {
+				group = _timelineGroups[ii];
+				break;
+			}
+		}
+		if (!group) {
+			group = new (__FILE__, __LINE__) TimelineGroup(timeline);
+			_timelineGroups.add(group);
+		}
+		group->add(timeline, (int) i);
+	}
+}
+
+Vector<TimelineGroup *> &Animation::getTimelineGroups() {
+	return _timelineGroups;
 }
 
 void Animation::apply(Skeleton &skeleton, float lastTime, float time, bool loop, Vector<Event *> *pEvents, float alpha,
@@ -70,6 +135,14 @@ void Animation::apply(Skeleton &skeleton, float lastTime, float time, bool loop,
 		}
 	}
 
+	if (_timelineGroups.size() > 0) {
+		for (size_t i = 0, n = _ungroupedTimelines.size(); i < n; ++i)
+			_timelines[_ungroupedTimelines[i]]->apply(skeleton, lastTime, time, pEvents, alpha, blend, direction);
+		for (size_t i = 0, n = _timelineGroups.size(); i < n; ++i)
+			_timelineGroups[i]->apply(skeleton, time, alpha, blend, NULL);
+		return;
+	}
+
 	for (size_t i = 0, n = _timelines.size(); i < n; ++i) {
 		_timelines[i]->apply(skeleton, lastTime, time, pEvents, alpha, blend, direction);
 	}
@@ -91,17 +164,44 @@ void Animation::setDuration(float inValue) {
 	_duration = inValue;
 }
 
-int Animation::search(Vector<float> &frames, float target) {
-	size_t n = (int) frames.size();
-	for (size_t i = 1; i < n; i++) {
-		if (frames[i] > target) return (int) (i - 1);
+static inline bool isFrame(const float *frames, int n, int i, int step, float target) {
+	return (i == 0 || !(frames[i] > target)) && (i + step >= n || frames[i + step] > target);
+}
+
+int Animation::search(Vector<float> &values, float target, int step, int *cursor) {
+	const float *frames = values.buffer();
+	int n = (int) values.size();
+	if (cursor != NULL) {
+		// Playback is coherent, so the frame is usually the previous result or the one after it.
+		int i = *cursor;
+		if (i <= n - step) {
+			if (isFrame(frames, n, i, step, target)) return i;
+			i += step;
+			if (i <= n - step && isFrame(frames, n, i, step, target)) {
+				*cursor = i;
+				return i;
+			}
+		}
+	}
+
+	// Find the first frame after the target.
+	int low = 1, high = n / step;
+	while (low < high) {
+		int middle = (low + high) >> 1;
+		if (frames[middle * step] > target)
+			high = middle;
+		else
+			low = middle + 1;
 	}
-	return (int) (n - 1);
+	int i = (low - 1) * step;
+	if (cursor != NULL) *cursor = i;
+	return i;
+}
+
+int Animation::search(Vector<float> &frames, float target) {
+	return search(frames, target, 1, NULL);
 }
 
 int Animation::search(Vector<float> &frames, float target, int step) {
-	size_t n = frames.size();
-	for (size_t i = step; i < n; i += step)
-		if (frames[i] > target) return (int) (i - step);
-	return (int) (n - step);
+	return search(frames, target, step, NULL);
 }
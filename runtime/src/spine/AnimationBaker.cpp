@@ -0,0 +1,180 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/AnimationBaker.h>
+
+#include <spine/Animation.h>
+#include <spine/BakedAnimation.h>
+#include <spine/Bone.h>
+#include <spine/CurveTimeline.h>
+#include <spine/MathUtil.h>
+#include <spine/Property.h>
+#include <spine/Skeleton.h>
+#include <spine/SkeletonData.h>
+#include <spine/Slot.h>
+#include <spine/Timeline.h>
+
+using namespace spine;
+
+static const int BoneProperties = Property_Rotate | Property_X | Property_Y | Property_ScaleX | Property_ScaleY |
+								  Property_ShearX | Property_ShearY;
+
+static const int SlotProperties = Property_Rgb | Property_Alpha | Property_Rgb2;
+
+static PoseChannel getPoseChannel(int property) {
+	switch (property) {
+		case Property_Rotate:
+			return PoseChannel_Rotation;
+		case Property_X:
+			return PoseChannel_X;
+		case Property_Y:
+			return PoseChannel_Y;
+		case Property_ScaleX:
+			return PoseChannel_ScaleX;
+		case Property_ScaleY:
+			return PoseChannel_ScaleY;
+		case Property_ShearX:
+			return PoseChannel_ShearX;
+		default:
+			return PoseChannel_ShearY;
+	}
+}
+
+static void setAllBonesActive(Skeleton &skeleton) {
+	Vector<Bone *> &bones = skeleton.getBones();
+	for (size_t i = 0, n = bones.size(); i < n; i++)
+		bones[i]->setActive(true);
+}
+
+AnimationBaker::AnimationBaker(SkeletonData *skeletonData, float frameRate) : _skeletonData(skeletonData),
+																			  _frameRate(frameRate) {
+	assert(frameRate > 0);
+}
+
+AnimationBaker::~AnimationBaker() {
+}
+
+BakedAnimation *AnimationBaker::bake(Animation &animation) {
+	float duration = animation.getDuration(), intervals = duration * _frameRate;
+	size_t intervalCount = (size_t) intervals;
+	if (intervalCount < intervals) intervalCount++;
+	BakedAnimation *baked = new (__FILE__, __LINE__) BakedAnimation(animation, _frameRate, intervalCount + 1);
+
+	Skeleton skeleton(_skeletonData);
+	setAllBonesActive(skeleton);
+	SkeletonPose &pose = skeleton.getPose();
+	Vector<Slot *> &slots = skeleton.getSlots();
+
+	// Bake timelines that only key bone transforms and slot colors, the others are applied as is. Stepped frames would
+	// be smeared over a sample interval, so timelines with them are not baked either.
+	Vector<Timeline *> &timelines = animation.getTimelines();
+	for (size_t i = 0, n = timelines.size(); i < n; i++) {
+		Timeline *timeline = timelines[i];
+		Vector<PropertyId> &ids = timeline->getPropertyIds();
+		bool bake = !timeline->getRTTI().instanceOf(CurveTimeline::rtti) ||
+					!static_cast<CurveTimeline *>(timeline)->hasSteppedFrames();
+		for (size_t ii = 0; ii < ids.size(); ii++) {
+			if (((int) (ids[ii] >> 32) & (BoneProperties | SlotProperties)) == 0) {
+				bake = false;
+				break;
+			}
+		}
+		if (!bake) {
+			baked->_timelines.add(timeline);
+			continue;
+		}
+		for (size_t ii = 0; ii < ids.size(); ii++) {
+			int property = (int) (ids[ii] >> 32), index = (int) (ids[ii] & 0xffffffff);
+			if (property & BoneProperties) {
+				PoseChannel channel = getPoseChannel(property);
+				baked->addBoneValue(index, channel, pose.getChannel(channel)[index]);
+				continue;
+			}
+			int first = property == Property_Rgb ? 0 : (property == Property_Alpha ? 3 : 4);
+			int last = property == Property_Alpha ? 3 : first + 2;
+			for (int component = first; component <= last; component++)
+				baked->addSlotValue(index, component, BakedAnimation::getSlotValue(*slots[index], component));
+		}
+	}
+
+	baked->_values.setSize(baked->_frameCount * baked->getValueCount(), 0);
+	for (size_t frame = 0; frame < baked->_frameCount; frame++) {
+		float time = frame == intervalCount ? duration : frame * baked->_frameInterval;
+		skeleton.setToSetupPose();
+		animation.apply(skeleton, time, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+		baked->setFrame(frame, skeleton);
+	}
+	return baked;
+}
+
+float AnimationBaker::getError(BakedAnimation &bakedAnimation, int subdivisions) {
+	Skeleton live(_skeletonData), baked(_skeletonData);
+	setAllBonesActive(live);
+	setAllBonesActive(baked);
+	SkeletonPose &livePose = live.getPose(), &bakedPose = baked.getPose();
+	Vector<Slot *> &liveSlots = live.getSlots(), &bakedSlots = baked.getSlots();
+
+	Animation &animation = bakedAnimation.getAnimation();
+	float duration = animation.getDuration(), step = bakedAnimation.getFrameInterval() / subdivisions;
+	size_t count = step > 0 ? (size_t) (duration / step) + 1 : 1;
+	float error = 0;
+	for (size_t i = 0; i < count; i++) {
+		float time = MathUtil::min(i * step, duration);
+		live.setToSetupPose();
+		animation.apply(live, time, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+		baked.setToSetupPose();
+		bakedAnimation.apply(baked, time, time, false, NULL, 1, MixBlend_Setup);
+
+		Vector<int> &bones = bakedAnimation._bones, &boneChannels = bakedAnimation._boneChannels;
+		for (size_t ii = 0, n = bones.size(); ii < n; ii++) {
+			PoseChannel channel = (PoseChannel) boneChannels[ii];
+			float difference = livePose.getChannel(channel)[bones[ii]] - bakedPose.getChannel(channel)[bones[ii]];
+			error = MathUtil::max(error, MathUtil::abs(difference));
+		}
+		Vector<int> &slots = bakedAnimation._slots, &slotChannels = bakedAnimation._slotChannels;
+		for (size_t ii = 0, n = slots.size(); ii < n; ii++) {
+			float difference = BakedAnimation::getSlotValue(*liveSlots[slots[ii]], slotChannels[ii]) -
+							   BakedAnimation::getSlotValue(*bakedSlots[slots[ii]], slotChannels[ii]);
+			error = MathUtil::max(error, MathUtil::abs(difference));
+		}
+	}
+	return error;
+}
+
+SkeletonData *AnimationBaker::getSkeletonData() {
+	return _skeletonData;
+}
+
+float AnimationBaker::getFrameRate() {
+	return _frameRate;
+}
+
+void AnimationBaker::setFrameRate(float inValue) {
+	_frameRate = inValue;
+}
@@ -36,11 +36,13 @@
 #include <spine/DrawOrderTimeline.h>
 #include <spine/Event.h>
 #include <spine/EventTimeline.h>
+#include <spine/PoseBuffer.h>
 #include <spine/RotateTimeline.h>
 #include <spine/Skeleton.h>
 #include <spine/SkeletonData.h>
 #include <spine/Slot.h>
 #include <spine/SlotData.h>
+#include <spine/TimelineGroup.h>
 
 #include <float.h>
 
@@ -60,7 +62,7 @@ TrackEntry::TrackEntry() : _animation(NULL), _previous(NULL), _next(NULL), _mixi
 						   _animationEnd(0), _animationLast(0), _nextAnimationLast(0), _delay(0), _trackTime(0),
 						   _trackLast(0), _nextTrackLast(0), _trackEnd(0), _timeScale(1.0f), _alpha(0), _mixTime(0),
 						   _mixDuration(0), _interruptAlpha(0), _totalAlpha(0), _mixBlend(MixBlend_Replace),
-						   _listener(dummyOnAnimationEventFunc), _listenerObject(NULL) {
+						   _listener(dummyOnAnimationEventFunc), _listenerObject(NULL), _eventMask(EventMask_All) {
 }
 
 TrackEntry::~TrackEntry() {}
@@ -180,6 +182,10 @@ void TrackEntry::setListener(AnimationStateListenerObject *inValue) {
 	_listenerObject = inValue;
 }
 
+int TrackEntry::getEventMask() { return _eventMask; }
+
+void TrackEntry::setEventMask(int inValue) { _eventMask = inValue; }
+
 void TrackEntry::reset() {
 	_animation = NULL;
 	_previous = NULL;
@@ -192,9 +198,20 @@ void TrackEntry::reset() {
 	_timelineMode.clear();
 	_timelineHoldMix.clear();
 	_timelinesRotation.clear();
+	_timelineCursors.clear();
 
 	_listener = dummyOnAnimationEventFunc;
 	_listenerObject = NULL;
+	_eventMask = EventMask_All;
+}
+
+void TrackEntry::skipTo(float trackTime) {
+	_trackTime = trackTime;
+	_trackLast = trackTime;
+	_nextTrackLast = trackTime;
+	_animationLast = getAnimationTime();
+	_nextAnimationLast = _animationLast;
+	_timelinesRotation.clear();
 }
 
 float TrackEntry::getTrackComplete() {
@@ -219,37 +236,74 @@ EventQueueEntry EventQueue::newEventQueueEntry(EventType eventType, TrackEntry *
 	return EventQueueEntry(eventType, entry, event);
 }
 
-EventQueue::EventQueue(AnimationState &state) : _state(state),
+EventQueue::EventQueue(AnimationState &state) : _head(0),
+												_count(0),
+												_state(state),
 												_drainDisabled(false) {
 }
 
 EventQueue::~EventQueue() {
 }
 
+bool EventQueue::isListened(TrackEntry *entry, EventType eventType) {
+	return ((entry->_eventMask | _state._eventMask) & (1 << eventType)) != 0;
+}
+
+void EventQueue::add(EventType eventType, TrackEntry *entry, Event *event) {
+	size_t capacity = _eventQueueEntries.size();
+	if (_count == capacity) {
+		// Grow and move the entries before _head past the old end, so the queued entries stay contiguous from _head.
+		size_t newCapacity = capacity ? capacity << 1 : 16;
+		_eventQueueEntries.setSize(newCapacity, newEventQueueEntry(EventType_Start, NULL));
+		for (size_t i = 0; i < _head; i++)
+			_eventQueueEntries[capacity + i] = _eventQueueEntries[i];
+		capacity = newCapacity;
+	}
+	size_t index = _head + _count;
+	if (index >= capacity) index -= capacity;
+	_eventQueueEntries[index] = newEventQueueEntry(eventType, entry, event);
+	_count++;
+}
+
+void EventQueue::notify(EventType eventType, TrackEntry *entry, Event *event) {
+	int bit = 1 << eventType;
+	if (entry->_eventMask & bit) {
+		if (!entry->_listenerObject) entry->_listener(&_state, eventType, entry, event);
+		else
+			entry->_listenerObject->callback(&_state, eventType, entry, event);
+	}
+	if (_state._eventMask & bit) {
+		if (!_state._listenerObject) _state._listener(&_state, eventType, entry, event);
+		else
+			_state._listenerObject->callback(&_state, eventType, entry, event);
+	}
+}
+
 void EventQueue::start(TrackEntry *entry) {
-	_eventQueueEntries.add(newEventQueueEntry(EventType_Start, entry));
+	if (isListened(entry, EventType_Start)) add(EventType_Start, entry);
 	_state._animationsChanged = true;
 }
 
 void EventQueue::interrupt(TrackEntry *entry) {
-	_eventQueueEntries.add(newEventQueueEntry(EventType_Interrupt, entry));
+	if (isListened(entry, EventType_Interrupt)) add(EventType_Interrupt, entry);
 }
 
 void EventQueue::end(TrackEntry *entry) {
-	_eventQueueEntries.add(newEventQueueEntry(EventType_End, entry));
+	// The entry must still be disposed when no one listens to end.
+	add(isListened(entry, EventType_End) ? EventType_End : EventType_Dispose, entry);
 	_state._animationsChanged = true;
 }
 
 void EventQueue::dispose(TrackEntry *entry) {
-	_eventQueueEntries.add(newEventQueueEntry(EventType_Dispose, entry));
+	add(EventType_Dispose, entry);
 }
 
 void EventQueue::complete(TrackEntry *entry) {
-	_eventQueueEntries.add(newEventQueueEntry(EventType_Complete, entry));
+	if (isListened(entry, EventType_Complete)) add(EventType_Complete, entry);
 }
 
 void EventQueue::event(TrackEntry *entry, Event *event) {
-	_eventQueueEntries.add(newEventQueueEntry(EventType_Event, entry, event));
+	if (isListened(entry, EventType_Event)) add(EventType_Event, entry, event);
 }
 
 /// Raises all events in the queue and drains the queue.
@@ -260,54 +314,33 @@ void EventQueue::drain() {
 
 	_drainDisabled = true;
 
-	AnimationState &state = _state;
-
-	// Don't cache _eventQueueEntries.size() so callbacks can queue their own events (eg, call setAnimation in AnimationState_Complete).
-	for (size_t i = 0; i < _eventQueueEntries.size(); ++i) {
-		EventQueueEntry queueEntry = _eventQueueEntries[i];
+	// Callbacks can queue their own events (eg, call setAnimation in AnimationState_Complete), which are raised in this
+	// drain. Copy the entry since queueing can grow the buffer.
+	while (_count > 0) {
+		EventQueueEntry queueEntry = _eventQueueEntries[_head];
+		if (++_head == _eventQueueEntries.size()) _head = 0;
+		_count--;
 		TrackEntry *trackEntry = queueEntry._entry;
 
 		switch (queueEntry._type) {
 			case EventType_Start:
 			case EventType_Interrupt:
 			case EventType_Complete:
-				if (!trackEntry->_listenerObject) trackEntry->_listener(&state, queueEntry._type, trackEntry, NULL);
-				else
-					trackEntry->_listenerObject->callback(&state, queueEntry._type, trackEntry, NULL);
-				if (!state._listenerObject) state._listener(&state, queueEntry._type, trackEntry, NULL);
-				else
-					state._listenerObject->callback(&state, queueEntry._type, trackEntry, NULL);
+				notify(queueEntry._type, trackEntry, NULL);
 				break;
 			case EventType_End:
-				if (!trackEntry->_listenerObject) trackEntry->_listener(&state, queueEntry._type, trackEntry, NULL);
-				else
-					trackEntry->_listenerObject->callback(&state, queueEntry._type, trackEntry, NULL);
-				if (!state._listenerObject) state._listener(&state, queueEntry._type, trackEntry, NULL);
-				else
-					state._listenerObject->callback(&state, queueEntry._type, trackEntry, NULL);
+				notify(EventType_End, trackEntry, NULL);
 				/* Fall through. */
 			case EventType_Dispose:
-				if (!trackEntry->_listenerObject) trackEntry->_listener(&state, EventType_Dispose, trackEntry, NULL);
-				else
-					trackEntry->_listenerObject->callback(&state, EventType_Dispose, trackEntry, NULL);
-				if (!state._listenerObject) state._listener(&state, EventType_Dispose, trackEntry, NULL);
-				else
-					state._listenerObject->callback(&state, EventType_Dispose, trackEntry, NULL);
-
+				notify(EventType_Dispose, trackEntry, NULL);
 				if (!_state.getManualTrackEntryDisposal()) _state.disposeTrackEntry(trackEntry);
 				break;
 			case EventType_Event:
-				if (!trackEntry->_listenerObject)
-					trackEntry->_listener(&state, queueEntry._type, trackEntry, queueEntry._event);
-				else
-					trackEntry->_listenerObject->callback(&state, queueEntry._type, trackEntry, queueEntry._event);
-				if (!state._listenerObject) state._listener(&state, queueEntry._type, trackEntry, queueEntry._event);
-				else
-					state._listenerObject->callback(&state, queueEntry._type, trackEntry, queueEntry._event);
+				notify(EventType_Event, trackEntry, queueEntry._event);
 				break;
 		}
 	}
-	_eventQueueEntries.clear();
+	_head = 0;
 
 	_drainDisabled = false;
 }
@@ -319,7 +352,8 @@ AnimationState::AnimationState(AnimationStateData *data) : _data(data),
 														   _listenerObject(NULL),
 														   _unkeyedState(0),
 														   _timeScale(1),
-														   _manualTrackEntryDisposal(false) {
+														   _manualTrackEntryDisposal(false),
+														   _eventMask(EventMask_All) {
 }
 
 AnimationState::~AnimationState() {
@@ -445,15 +479,26 @@ bool AnimationState::apply(Skeleton &skeleton) {
 		}
 		size_t timelineCount = current._animation->_timelines.size();
 		Vector<Timeline *> &timelines = current._animation->_timelines;
+		if (current._timelineCursors.size() != timelineCount) current._timelineCursors.setSize(timelineCount, 0);
+		Vector<int> &timelineCursors = current._timelineCursors;
 		if ((i == 0 && mix == 1) || blend == MixBlend_Add) {
-			for (size_t ii = 0; ii < timelineCount; ++ii) {
-				Timeline *timeline = timelines[ii];
+			// Grouped timelines are applied after the others, a group at a time.
+			Vector<TimelineGroup *> &timelineGroups = current._animation->_timelineGroups;
+			Vector<int> &ungroupedTimelines = current._animation->_ungroupedTimelines;
+			bool grouped = timelineGroups.size() > 0;
+			for (size_t ii = 0, nn = grouped ? ungroupedTimelines.size() : timelineCount; ii < nn; ++ii) {
+				size_t index = grouped ? (size_t) ungroupedTimelines[ii] : ii;
+				Timeline *timeline = timelines[index];
+				int *cursor = &timelineCursors[index];
 				if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti))
 					applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timeline), skeleton, applyTime, blend,
-											true);
+											true, cursor);
 				else
-					timeline->apply(skeleton, animationLast, applyTime, applyEvents, mix, blend, MixDirection_In);
+					timeline->apply(skeleton, animationLast, applyTime, applyEvents, mix, blend, MixDirection_In,
+									cursor);
 			}
+			for (size_t ii = 0, nn = timelineGroups.size(); ii < nn; ++ii)
+				timelineGroups[ii]->apply(skeleton, applyTime, mix, blend, timelineCursors.buffer());
 		} else {
 			Vector<int> &timelineMode = current._timelineMode;
 
@@ -465,18 +510,19 @@ bool AnimationState::apply(Skeleton &skeleton) {
 			for (size_t ii = 0; ii < timelineCount; ++ii) {
 				Timeline *timeline = timelines[ii];
 				assert(timeline);
+				int *cursor = &timelineCursors[ii];
 
 				MixBlend timelineBlend = timelineMode[ii] == Subsequent ? blend : MixBlend_Setup;
 
 				if (!shortestRotation && timeline->getRTTI().isExactly(RotateTimeline::rtti))
 					applyRotateTimeline(static_cast<RotateTimeline *>(timeline), skeleton, applyTime, mix,
-										timelineBlend, timelinesRotation, ii << 1, firstFrame);
+										timelineBlend, timelinesRotation, ii << 1, firstFrame, cursor);
 				else if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti))
 					applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timeline), skeleton, applyTime,
-											timelineBlend, true);
+											timelineBlend, true, cursor);
 				else
 					timeline->apply(skeleton, animationLast, applyTime, applyEvents, mix, timelineBlend,
-									MixDirection_In);
+									MixDirection_In, cursor);
 			}
 		}
 
@@ -501,6 +547,119 @@ bool AnimationState::apply(Skeleton &skeleton) {
 	return applied;
 }
 
+bool AnimationState::apply(Skeleton &skeleton, PoseBuffer &pose) {
+	bool oldDrainDisabled = _queue->_drainDisabled;
+	_queue->_drainDisabled = true;
+	bool applied = apply(skeleton);
+	_queue->_drainDisabled = oldDrainDisabled;
+	pose.capture(skeleton);
+	return applied;
+}
+
+bool AnimationState::applyEvents() {
+	bool applied = false;
+	for (size_t i = 0, n = _tracks.size(); i < n; ++i) {
+		TrackEntry *current = _tracks[i];
+		if (current == NULL || current->_delay > 0) continue;
+		applied = true;
+
+		if (current->_mixingFrom != NULL) applyMixingFromEvents(current);
+
+		float animationTime = current->getAnimationTime();
+		if (!current->_reverse) collectEvents(current, current->_animationLast, animationTime);
+		queueEvents(current, animationTime);
+		_events.clear();
+		current->_nextAnimationLast = animationTime;
+		current->_nextTrackLast = current->_trackTime;
+	}
+
+	_queue->drain();
+	return applied;
+}
+
+void AnimationState::applyMixingFromEvents(TrackEntry *to) {
+	TrackEntry *from = to->_mixingFrom;
+	if (from->_mixingFrom != NULL) applyMixingFromEvents(from);
+
+	float mix = to->_mixDuration == 0 ? 1 : MathUtil::min(1.0f, to->_mixTime / to->_mixDuration);
+	float animationTime = from->getAnimationTime();
+	if (!from->_reverse && mix < from->_eventThreshold) collectEvents(from, from->_animationLast, animationTime);
+	if (to->_mixDuration > 0) queueEvents(from, animationTime);
+	_events.clear();
+	from->_nextAnimationLast = animationTime;
+	from->_nextTrackLast = from->_trackTime;
+}
+
+TrackEntry *AnimationState::seek(size_t trackIndex, float trackTime, bool fireEvents) {
+	if (trackIndex >= _tracks.size()) return NULL;
+	TrackEntry *entry = _tracks[trackIndex];
+	if (entry == NULL) return NULL;
+
+	entry->_delay = 0;
+	TrackEntry *from = entry->_mixingFrom;
+	if (from != NULL) {
+		entry->_mixingFrom = NULL;
+		from->_mixingTo = NULL;
+		while (from != NULL) {
+			_queue->end(from);
+			from = from->_mixingFrom;
+		}
+	}
+	// The mix is complete, an interrupted mix leaves no partial alpha behind.
+	entry->_mixTime = entry->_mixDuration;
+	entry->_interruptAlpha = 1;
+
+	if (fireEvents && trackTime > entry->_nextTrackLast && !entry->_reverse) queueSkippedEvents(entry, trackTime);
+
+	entry->skipTo(trackTime);
+	_queue->drain();
+	return entry;
+}
+
+void AnimationState::fastForward(float delta, bool fireEvents) {
+	delta *= _timeScale;
+	for (size_t i = 0; i < _tracks.size(); ++i) {
+		// Go through the queued entries whose delay passes, finishing each mix and carrying over the leftover time.
+		float trackDelta = delta;
+		while (true) {
+			TrackEntry *entry = _tracks[i];
+			if (entry == NULL) break;
+			float entryDelta = trackDelta * entry->_timeScale;
+			if (entry->_delay > 0) {
+				entry->_delay -= entryDelta;
+				if (entry->_delay > 0) break;
+				entryDelta = -entry->_delay;
+				entry->_delay = 0;
+			}
+
+			TrackEntry *next = entry->_next;
+			float nextTime = next != NULL ? entry->_trackTime + entryDelta - next->_delay : -1;
+			if (nextTime < 0) {
+				seek(i, entry->_trackTime + entryDelta, fireEvents);
+				break;
+			}
+
+			seek(i, next->_delay, fireEvents);
+			trackDelta = entry->_timeScale == 0 ? 0 : nextTime / entry->_timeScale;
+			// Listeners may have changed the track while seeking. Like update(), stop there instead of spending the rest of
+			// the time on the new entry.
+			if (i >= _tracks.size() || _tracks[i] != entry || entry->_next != next) break;
+			next->_delay = 0;
+			setCurrent(i, next, true);
+			_queue->drain();
+		}
+	}
+	update(0);
+	if (fireEvents) return;
+
+	// Entries started by the update begin partway through, so their first apply would raise the skipped events.
+	for (size_t i = 0, n = _tracks.size(); i < n; ++i) {
+		TrackEntry *entry = _tracks[i];
+		if (entry != NULL && entry->_nextTrackLast == -1 && entry->_trackTime > 0)
+			entry->skipTo(entry->_trackTime);
+	}
+}
+
 void AnimationState::clearTracks() {
 	bool oldDrainDisabled = _queue->_drainDisabled;
 	_queue->_drainDisabled = true;
@@ -673,6 +832,14 @@ bool AnimationState::getManualTrackEntryDisposal() {
 	return _manualTrackEntryDisposal;
 }
 
+int AnimationState::getEventMask() {
+	return _eventMask;
+}
+
+void AnimationState::setEventMask(int inValue) {
+	_eventMask = inValue;
+}
+
 void AnimationState::disposeTrackEntry(TrackEntry *entry) {
 	entry->reset();
 	_trackEntryPool.free(entry);
@@ -685,7 +852,7 @@ Animation *AnimationState::getEmptyAnimation() {
 }
 
 void AnimationState::applyAttachmentTimeline(AttachmentTimeline *attachmentTimeline, Skeleton &skeleton, float time,
-											 MixBlend blend, bool attachments) {
+											 MixBlend blend, bool attachments, int *searchCursor) {
 	Slot *slot = skeleton.getSlots()[attachmentTimeline->getSlotIndex()];
 	if (!slot->getBone().isActive()) return;
 
@@ -694,8 +861,8 @@ void AnimationState::applyAttachmentTimeline(AttachmentTimeline *attachmentTimel
 		if (blend == MixBlend_Setup || blend == MixBlend_First)
 			setAttachment(skeleton, *slot, slot->getData().getAttachmentName(), attachments);
 	} else {
-		setAttachment(skeleton, *slot, attachmentTimeline->getAttachmentNames()[Animation::search(frames, time)],
-					  attachments);
+		int frame = Animation::search(frames, time, 1, searchCursor);
+		setAttachment(skeleton, *slot, attachmentTimeline->getAttachmentNames()[frame], attachments);
 	}
 
 	/* If an attachment wasn't set (ie before the first frame or attachments is false), set the setup attachment later.*/
@@ -704,11 +871,12 @@ void AnimationState::applyAttachmentTimeline(AttachmentTimeline *attachmentTimel
 
 
 void AnimationState::applyRotateTimeline(RotateTimeline *rotateTimeline, Skeleton &skeleton, float time, float alpha,
-										 MixBlend blend, Vector<float> &timelinesRotation, size_t i, bool firstFrame) {
+										 MixBlend blend, Vector<float> &timelinesRotation, size_t i, bool firstFrame,
+										 int *searchCursor) {
 	if (firstFrame) timelinesRotation[i] = 0;
 
 	if (alpha == 1) {
-		rotateTimeline->apply(skeleton, 0, time, NULL, 1, blend, MixDirection_In);
+		rotateTimeline->apply(skeleton, 0, time, NULL, 1, blend, MixDirection_In, searchCursor);
 		return;
 	}
 
@@ -719,16 +887,16 @@ void AnimationState::applyRotateTimeline(RotateTimeline *rotateTimeline, Skeleto
 	if (time < frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_rotation = bone->_data._rotation;
+				bone->_rotation() = bone->_data._rotation;
 			default:
 				return;
 			case MixBlend_First:
-				r1 = bone->_rotation;
+				r1 = bone->_rotation();
 				r2 = bone->_data._rotation;
 		}
 	} else {
-		r1 = blend == MixBlend_Setup ? bone->_data._rotation : bone->_rotation;
-		r2 = bone->_data._rotation + rotateTimeline->getCurveValue(time);
+		r1 = blend == MixBlend_Setup ? bone->_data._rotation : bone->_rotation();
+		r2 = bone->_data._rotation + rotateTimeline->getCurveValue(time, searchCursor);
 	}
 
 	// Mix between rotations using the direction of the shortest route on the first frame while detecting crosses.
@@ -761,7 +929,7 @@ void AnimationState::applyRotateTimeline(RotateTimeline *rotateTimeline, Skeleto
 		timelinesRotation[i] = total;
 	}
 	timelinesRotation[i + 1] = diff;
-	bone->_rotation = r1 + total * alpha;
+	bone->_rotation() = r1 + total * alpha;
 }
 
 bool AnimationState::updateMixingFrom(TrackEntry *to, float delta) {
@@ -823,9 +991,12 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 		if (mix < from->_eventThreshold) events = &_events;
 	}
 
+	if (from->_timelineCursors.size() != timelineCount) from->_timelineCursors.setSize(timelineCount, 0);
+	Vector<int> &timelineCursors = from->_timelineCursors;
 	if (blend == MixBlend_Add) {
 		for (size_t i = 0; i < timelineCount; i++)
-			timelines[i]->apply(skeleton, animationLast, applyTime, events, alphaMix, blend, MixDirection_Out);
+			timelines[i]->apply(skeleton, animationLast, applyTime, events, alphaMix, blend, MixDirection_Out,
+								&timelineCursors[i]);
 	} else {
 		Vector<int> &timelineMode = from->_timelineMode;
 		Vector<TrackEntry *> &timelineHoldMix = from->_timelineHoldMix;
@@ -839,6 +1010,7 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 		from->_totalAlpha = 0;
 		for (size_t i = 0; i < timelineCount; i++) {
 			Timeline *timeline = timelines[i];
+			int *cursor = &timelineCursors[i];
 			MixDirection direction = MixDirection_Out;
 			MixBlend timelineBlend;
 			float alpha;
@@ -869,15 +1041,15 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 			from->_totalAlpha += alpha;
 			if (!shortestRotation && (timeline->getRTTI().isExactly(RotateTimeline::rtti))) {
 				applyRotateTimeline((RotateTimeline *) timeline, skeleton, applyTime, alpha, timelineBlend,
-									timelinesRotation, i << 1, firstFrame);
+									timelinesRotation, i << 1, firstFrame, cursor);
 			} else if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti)) {
 				applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timeline), skeleton, applyTime, timelineBlend,
-										attachments);
+										attachments, cursor);
 			} else {
 				if (drawOrder && timeline->getRTTI().isExactly(DrawOrderTimeline::rtti) &&
 					timelineBlend == MixBlend_Setup)
 					direction = MixDirection_In;
-				timeline->apply(skeleton, animationLast, applyTime, events, alpha, timelineBlend, direction);
+				timeline->apply(skeleton, animationLast, applyTime, events, alpha, timelineBlend, direction, cursor);
 			}
 		}
 	}
@@ -929,6 +1101,43 @@ void AnimationState::queueEvents(TrackEntry *entry, float animationTime) {
 	}
 }
 
+void AnimationState::queueSkippedEvents(TrackEntry *entry, float trackTime) {
+	float animationStart = entry->_animationStart, animationEnd = entry->_animationEnd;
+	float duration = animationEnd - animationStart;
+	float trackLast = entry->_nextTrackLast, animationLast = entry->_nextAnimationLast;
+
+	// Each loop iteration queues its events, then its completion, like queueEvents() does for one apply.
+	int iteration = 0, lastIteration = 0;
+	if (entry->_loop && duration > 0) {
+		iteration = (int) (MathUtil::max(trackLast, 0.0f) / duration);
+		lastIteration = (int) (trackTime / duration);
+	}
+	for (; iteration <= lastIteration; iteration++) {
+		float time = FLT_MAX;
+		if (iteration == lastIteration) {
+			if (!entry->_loop)
+				time = MathUtil::min(trackTime + animationStart, animationEnd);
+			else
+				time = duration == 0 ? animationStart : MathUtil::fmod(trackTime, duration) + animationStart;
+		}
+		collectEvents(entry, animationLast, time);
+		for (size_t i = 0, n = _events.size(); i < n; ++i) {
+			Event *e = _events[i];
+			if (e->_time >= animationStart && e->_time <= animationEnd) _queue->event(entry, e);
+		}
+		_events.clear();
+		if (iteration < lastIteration || (!entry->_loop && animationLast < animationEnd && time >= animationEnd))
+			_queue->complete(entry);
+		animationLast = -1;
+	}
+}
+
+void AnimationState::collectEvents(TrackEntry *entry, float lastTime, float time) {
+	Vector<EventTimeline *> &eventTimelines = entry->_animation->_eventTimelines;
+	for (size_t i = 0, n = eventTimelines.size(); i < n; ++i)
+		eventTimelines[i]->collectEvents(lastTime, time, _events);
+}
+
 void AnimationState::setCurrent(size_t index, TrackEntry *current, bool interrupt) {
 	TrackEntry *from = expandToIndex(index);
 	_tracks[index] = current;
@@ -1009,7 +1218,19 @@ void AnimationState::clearNext(TrackEntry *entry) {
 void AnimationState::animationsChanged() {
 	_animationsChanged = false;
 
-	_propertyIDs.clear();
+	bool memoize = _data->getTimelineModeCacheSize() > 0;
+	if (memoize) {
+		buildTimelineModeKey();
+		if (_data->findTimelineModes(_timelineModes) && loadTimelineModes()) return;
+	}
+
+	_propertyBits.clear();
+
+	SkeletonData *skeletonData = _data->_skeletonData;
+	for (size_t i = 0, n = _tracks.size(); i < n; ++i) {
+		for (TrackEntry *entry = _tracks[i]; entry != NULL; entry = entry->_mixingFrom)
+			entry->_animation->indexProperties(*skeletonData);
+	}
 
 	for (size_t i = 0, n = _tracks.size(); i < n; ++i) {
 		TrackEntry *entry = _tracks[i];
@@ -1023,11 +1244,121 @@ void AnimationState::animationsChanged() {
 			entry = entry->_mixingTo;
 		} while (entry != NULL);
 	}
+
+	if (memoize) {
+		saveTimelineModes();
+		_data->addTimelineModes(_timelineModes);
+	}
+}
+
+void AnimationState::buildTimelineModeKey() {
+	Vector<const void *> &key = _timelineModes._key;
+	key.clear();
+	for (size_t i = 0, n = _tracks.size(); i < n; ++i) {
+		TrackEntry *entry = _tracks[i];
+		if (entry) {
+			while (entry->_mixingFrom != NULL)
+				entry = entry->_mixingFrom;
+			for (; entry != NULL; entry = entry->_mixingTo) {
+				size_t flags = (entry->_holdPrevious ? 1 : 0) | (entry->_mixBlend == MixBlend_Add ? 2 : 0) |
+							   (entry->_mixDuration > 0 ? 4 : 0);
+				key.add((const void *) entry->_animation->_id);
+				key.add((const void *) flags);
+			}
+		}
+		key.add(NULL);
+	}
+	_timelineModes._hash = TimelineModes::hashKey(key);
+}
+
+bool AnimationState::loadTimelineModes() {
+	Vector<int> &modes = _timelineModes._modes, &holdMixes = _timelineModes._holdMixes;
+	Vector<int> &timelineCounts = _timelineModes._timelineCounts;
+	Vector<size_t> &propertyHashes = _timelineModes._propertyHashes;
+	size_t offset = 0, entryIndex = 0;
+	for (size_t i = 0, n = _tracks.size(); i < n; ++i) {
+		TrackEntry *entry = _tracks[i];
+		if (!entry) continue;
+
+		while (entry->_mixingFrom != NULL)
+			entry = entry->_mixingFrom;
+
+		for (; entry != NULL; entry = entry->_mixingTo) {
+			if (entry->_mixingTo != NULL && entry->_mixBlend == MixBlend_Add) continue;
+			size_t timelinesCount = entry->_animation->_timelines.size();
+			if (entryIndex == timelineCounts.size() || (size_t) timelineCounts[entryIndex] != timelinesCount ||
+				propertyHashes[entryIndex] != entry->_animation->_propertyHash)
+				return false;
+			entryIndex++;
+			entry->_timelineMode.setSize(timelinesCount, 0);
+			entry->_timelineHoldMix.setSize(timelinesCount, 0);
+			for (size_t ii = 0; ii < timelinesCount; ii++, offset++) {
+				entry->_timelineMode[ii] = modes[offset];
+				TrackEntry *holdMix = NULL;
+				if (holdMixes[offset] > 0) {
+					holdMix = entry;
+					for (int step = holdMixes[offset]; step > 0; step--)
+						holdMix = holdMix->_mixingTo;
+				}
+				entry->_timelineHoldMix[ii] = holdMix;
+			}
+		}
+	}
+	return entryIndex == timelineCounts.size();
+}
+
+void AnimationState::saveTimelineModes() {
+	Vector<int> &modes = _timelineModes._modes, &holdMixes = _timelineModes._holdMixes;
+	Vector<int> &timelineCounts = _timelineModes._timelineCounts;
+	Vector<size_t> &propertyHashes = _timelineModes._propertyHashes;
+	modes.clear();
+	holdMixes.clear();
+	timelineCounts.clear();
+	propertyHashes.clear();
+	for (size_t i = 0, n = _tracks.size(); i < n; ++i) {
+		TrackEntry *entry = _tracks[i];
+		if (!entry) continue;
+
+		while (entry->_mixingFrom != NULL)
+			entry = entry->_mixingFrom;
+
+		for (; entry != NULL; entry = entry->_mixingTo) {
+			if (entry->_mixingTo != NULL && entry->_mixBlend == MixBlend_Add) continue;
+			timelineCounts.add((int) entry->_timelineMode.size());
+			propertyHashes.add(entry->_animation->_propertyHash);
+			for (size_t ii = 0, nn = entry->_timelineMode.size(); ii < nn; ii++) {
+				modes.add(entry->_timelineMode[ii]);
+				// Hold mix entries of other modes may be left from before.
+				int steps = 0;
+				if (entry->_timelineMode[ii] == HoldMix) {
+					for (TrackEntry *next = entry; next != entry->_timelineHoldMix[ii]; next = next->_mixingTo)
+						steps++;
+				}
+				holdMixes.add(steps);
+			}
+		}
+	}
+}
+
+bool AnimationState::addProperties(Animation &animation, size_t timelineIndex) {
+	bool added = false;
+	for (int i = animation._propertyStarts[timelineIndex], n = animation._propertyStarts[timelineIndex + 1]; i < n; i++) {
+		int index = animation._propertyIndices[i];
+		size_t word = (size_t) index >> 5;
+		unsigned int bit = 1u << (index & 31);
+		if (word >= _propertyBits.size()) _propertyBits.setSize(word + 1, 0);
+		if (!(_propertyBits[word] & bit)) {
+			_propertyBits[word] |= bit;
+			added = true;
+		}
+	}
+	return added;
 }
 
 void AnimationState::computeHold(TrackEntry *entry) {
 	TrackEntry *to = entry->_mixingTo;
-	Vector<Timeline *> &timelines = entry->_animation->_timelines;
+	Animation &animation = *entry->_animation;
+	Vector<Timeline *> &timelines = animation._timelines;
 	size_t timelinesCount = timelines.size();
 	Vector<int> &timelineMode = entry->_timelineMode;
 	timelineMode.setSize(timelinesCount, 0);
@@ -1036,7 +1367,7 @@ void AnimationState::computeHold(TrackEntry *entry) {
 
 	if (to != NULL && to->_holdPrevious) {
 		for (size_t i = 0; i < timelinesCount; i++) {
-			timelineMode[i] = _propertyIDs.addAll(timelines[i]->getPropertyIds(), true) ? HoldFirst : HoldSubsequent;
+			timelineMode[i] = addProperties(animation, i) ? HoldFirst : HoldSubsequent;
 		}
 		return;
 	}
@@ -1046,17 +1377,16 @@ void AnimationState::computeHold(TrackEntry *entry) {
 continue_outer:
 	for (; i < timelinesCount; ++i) {
 		Timeline *timeline = timelines[i];
-		Vector<PropertyId> &ids = timeline->getPropertyIds();
-		if (!_propertyIDs.addAll(ids, true)) {
+		if (!addProperties(animation, i)) {
 			timelineMode[i] = Subsequent;
 		} else {
 			if (to == NULL || timeline->getRTTI().isExactly(AttachmentTimeline::rtti) ||
 				timeline->getRTTI().isExactly(DrawOrderTimeline::rtti) ||
-				timeline->getRTTI().isExactly(EventTimeline::rtti) || !to->_animation->hasTimeline(ids)) {
+				timeline->getRTTI().isExactly(EventTimeline::rtti) || !to->_animation->hasProperties(animation, i)) {
 				timelineMode[i] = First;
 			} else {
 				for (TrackEntry *next = to->_mixingTo; next != NULL; next = next->_mixingTo) {
-					if (next->_animation->hasTimeline(ids)) continue;
+					if (next->_animation->hasProperties(animation, i)) continue;
 					if (next->_mixDuration > 0) {
 						timelineMode[i] = HoldMix;
 						timelineHoldMix[i] = next;
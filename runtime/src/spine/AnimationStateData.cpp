@@ -30,10 +30,35 @@
 #include <spine/AnimationStateData.h>
 #include <spine/Animation.h>
 #include <spine/SkeletonData.h>
+#include <spine/TimelineModes.h>
+
+#include <spine/ContainerUtil.h>
+
+#include <mutex>
 
 using namespace spine;
 
-AnimationStateData::AnimationStateData(SkeletonData *skeletonData) : _skeletonData(skeletonData), _defaultMix(0) {
+struct AnimationStateData::TimelineModeCache : public SpineObject {
+	std::mutex mutex;
+	Vector<TimelineModes *> modes;
+	size_t size;
+	size_t next; // The oldest modes, replaced next when full.
+
+	TimelineModeCache() : size(64), next(0) {
+	}
+
+	~TimelineModeCache() {
+		ContainerUtil::cleanUpVectorOfPointers(modes);
+	}
+};
+
+AnimationStateData::AnimationStateData(SkeletonData *skeletonData) : _skeletonData(skeletonData), _defaultMix(0),
+																	 _mixCount(0),
+																	 _timelineModeCache(new (__FILE__, __LINE__) TimelineModeCache()) {
+}
+
+AnimationStateData::~AnimationStateData() {
+	delete _timelineModeCache;
 }
 
 void AnimationStateData::setMix(const String &fromName, const String &toName, float duration) {
@@ -47,18 +72,19 @@ void AnimationStateData::setMix(Animation *from, Animation *to, float duration)
 	assert(from != NULL);
 	assert(to != NULL);
 
-	AnimationPair key(from, to);
-	_animationToMixTime.put(key, duration);
+	if ((_mixCount + 1) << 1 > _mixes.size()) resize(_mixes.size() ? _mixes.size() << 1 : 16);
+	MixEntry &entry = _mixes[find(from, to)];
+	if (!entry._from) _mixCount++;
+	entry = MixEntry(from, to, duration);
 }
 
 float AnimationStateData::getMix(Animation *from, Animation *to) {
 	assert(from != NULL);
 	assert(to != NULL);
 
-	AnimationPair key(from, to);
-
-	if (_animationToMixTime.containsKey(key)) return _animationToMixTime[key];
-	return _defaultMix;
+	if (_mixCount == 0) return _defaultMix;
+	MixEntry &entry = _mixes[find(from, to)];
+	return entry._from ? entry._duration : _defaultMix;
 }
 
 SkeletonData *AnimationStateData::getSkeletonData() {
@@ -75,12 +101,84 @@ void AnimationStateData::setDefaultMix(float inValue) {
 
 void AnimationStateData::clear() {
 	_defaultMix = 0;
-	_animationToMixTime.clear();
+	_mixes.clear();
+	_mixCount = 0;
+}
+
+size_t AnimationStateData::getTimelineModeCacheSize() {
+	std::lock_guard<std::mutex> lock(_timelineModeCache->mutex);
+	return _timelineModeCache->size;
+}
+
+void AnimationStateData::setTimelineModeCacheSize(size_t inValue) {
+	std::lock_guard<std::mutex> lock(_timelineModeCache->mutex);
+	TimelineModeCache &cache = *_timelineModeCache;
+	cache.size = inValue;
+	ContainerUtil::cleanUpVectorOfPointers(cache.modes);
+	cache.next = 0;
+}
+
+bool AnimationStateData::findTimelineModes(TimelineModes &modes) {
+	std::lock_guard<std::mutex> lock(_timelineModeCache->mutex);
+	Vector<TimelineModes *> &cached = _timelineModeCache->modes;
+	for (size_t i = 0, n = cached.size(); i < n; i++) {
+		if (cached[i]->matches(modes._key, modes._hash)) {
+			modes.set(*cached[i]);
+			return true;
+		}
+	}
+	return false;
+}
+
+void AnimationStateData::addTimelineModes(TimelineModes &modes) {
+	std::lock_guard<std::mutex> lock(_timelineModeCache->mutex);
+	TimelineModeCache &cache = *_timelineModeCache;
+	if (cache.size == 0) return;
+	// Modes that didn't fit the timelines are replaced.
+	for (size_t i = 0, n = cache.modes.size(); i < n; i++) {
+		if (cache.modes[i]->matches(modes._key, modes._hash)) {
+			cache.modes[i]->set(modes);
+			return;
+		}
+	}
+	if (cache.modes.size() < cache.size) {
+		cache.modes.add(new (__FILE__, __LINE__) TimelineModes());
+		cache.modes[cache.modes.size() - 1]->set(modes);
+		return;
+	}
+	cache.modes[cache.next]->set(modes);
+	cache.next = (cache.next + 1) % cache.size;
+}
+
+size_t AnimationStateData::hash(Animation *from, Animation *to) {
+	// Pointers are aligned, drop the low bits that are always zero.
+	size_t hash = 2166136261u;
+	hash = (hash ^ ((size_t) from >> 3)) * 16777619u;
+	hash = (hash ^ ((size_t) to >> 3)) * 16777619u;
+	return hash ^ (hash >> 16);
+}
+
+size_t AnimationStateData::find(Animation *from, Animation *to) {
+	size_t mask = _mixes.size() - 1;
+	size_t i = hash(from, to) & mask;
+	while (true) {
+		MixEntry &entry = _mixes[i];
+		if (!entry._from || (entry._from == from && entry._to == to)) return i;
+		i = (i + 1) & mask;
+	}
 }
 
-AnimationStateData::AnimationPair::AnimationPair(Animation *a1, Animation *a2) : _a1(a1), _a2(a2) {
+void AnimationStateData::resize(size_t capacity) {
+	Vector<MixEntry> mixes;
+	mixes.addAll(_mixes);
+	_mixes.clear();
+	_mixes.setSize(capacity, MixEntry());
+	for (size_t i = 0, n = mixes.size(); i < n; i++) {
+		MixEntry &entry = mixes[i];
+		if (entry._from) _mixes[find(entry._from, entry._to)] = entry;
+	}
 }
 
-bool AnimationStateData::AnimationPair::operator==(const AnimationPair &other) const {
-	return _a1->_name == other._a1->_name && _a2->_name == other._a2->_name;
+AnimationStateData::MixEntry::MixEntry(Animation *from, Animation *to, float duration) : _from(from), _to(to),
+																						 _duration(duration) {
 }
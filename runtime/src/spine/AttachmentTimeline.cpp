@@ -60,7 +60,7 @@ void AttachmentTimeline::setAttachment(Skeleton &skeleton, Slot &slot, String *a
 }
 
 void AttachmentTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-							   MixBlend blend, MixDirection direction) {
+							   MixBlend blend, MixDirection direction, int *searchCursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(alpha);
@@ -87,7 +87,7 @@ void AttachmentTimeline::apply(Skeleton &skeleton, float lastTime, float time, V
 		return;
 	}
 
-	setAttachment(skeleton, *slot, &_attachmentNames[Animation::search(_frames, time)]);
+	setAttachment(skeleton, *slot, &_attachmentNames[Animation::search(_frames, time, 1, searchCursor)]);
 }
 
 void AttachmentTimeline::setFrame(int frame, float time, const String &attachmentName) {
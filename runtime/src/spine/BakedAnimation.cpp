@@ -0,0 +1,185 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/BakedAnimation.h>
+
+#include <spine/Animation.h>
+#include <spine/Bone.h>
+#include <spine/MathUtil.h>
+#include <spine/Skeleton.h>
+#include <spine/Slot.h>
+#include <spine/Timeline.h>
+
+using namespace spine;
+
+BakedAnimation::BakedAnimation(Animation &animation, float frameRate, size_t frameCount) : _animation(animation),
+																						  _frameRate(frameRate),
+																						  _frameCount(frameCount),
+																						  _frameInterval(0) {
+	if (frameCount > 1) _frameInterval = animation.getDuration() / (frameCount - 1);
+}
+
+BakedAnimation::~BakedAnimation() {
+}
+
+void BakedAnimation::apply(Skeleton &skeleton, float lastTime, float time, bool loop, Vector<Event *> *pEvents,
+						   float alpha, MixBlend blend) {
+	float duration = _animation.getDuration();
+	if (loop && duration != 0) {
+		time = MathUtil::fmod(time, duration);
+		if (lastTime > 0) {
+			lastTime = MathUtil::fmod(lastTime, duration);
+		}
+	}
+
+	size_t frame = 0;
+	float percent = 0;
+	if (_frameInterval > 0 && time > 0) {
+		float position = time / _frameInterval;
+		if (position < _frameCount - 1) {
+			frame = (size_t) position;
+			percent = position - frame;
+		} else
+			frame = _frameCount - 1;
+	}
+	applyValues(skeleton, frame, percent, alpha, blend);
+
+	for (size_t i = 0, n = _timelines.size(); i < n; ++i)
+		_timelines[i]->apply(skeleton, lastTime, time, pEvents, alpha, blend, MixDirection_In);
+}
+
+void BakedAnimation::applyValues(Skeleton &skeleton, size_t frame, float percent, float alpha, MixBlend blend) {
+	size_t valueCount = getValueCount();
+	const float *values = _values.buffer() + frame * valueCount;
+	const float *next = frame + 1 < _frameCount ? values + valueCount : values;
+
+	Vector<Bone *> &bones = skeleton.getBones();
+	SkeletonPose &pose = skeleton.getPose();
+	for (size_t i = 0, n = _bones.size(); i < n; i++) {
+		int boneIndex = _bones[i];
+		if (!bones[boneIndex]->isActive()) continue;
+		float value = values[i] + (next[i] - values[i]) * percent;
+		float &current = pose.getChannel((PoseChannel) _boneChannels[i])[boneIndex];
+		switch (blend) {
+			case MixBlend_Setup:
+				current = _boneSetup[i] + (value - _boneSetup[i]) * alpha;
+				break;
+			case MixBlend_First:
+			case MixBlend_Replace:
+				current += (value - current) * alpha;
+				break;
+			case MixBlend_Add:
+				current += (value - _boneSetup[i]) * alpha;
+		}
+	}
+
+	values += _bones.size();
+	next += _bones.size();
+	Vector<Slot *> &slots = skeleton.getSlots();
+	for (size_t i = 0, n = _slots.size(); i < n; i++) {
+		Slot &slot = *slots[_slots[i]];
+		if (!slot.getBone().isActive()) continue;
+		float value = values[i] + (next[i] - values[i]) * percent;
+		float &current = getSlotValue(slot, _slotChannels[i]);
+		if (alpha == 1)
+			current = value;
+		else {
+			if (blend == MixBlend_Setup) current = _slotSetup[i];
+			current += (value - current) * alpha;
+		}
+		current = MathUtil::clamp(current, 0, 1);
+	}
+}
+
+void BakedAnimation::addBoneValue(int bone, int channel, float setup) {
+	_bones.add(bone);
+	_boneChannels.add(channel);
+	_boneSetup.add(setup);
+}
+
+void BakedAnimation::addSlotValue(int slot, int channel, float setup) {
+	_slots.add(slot);
+	_slotChannels.add(channel);
+	_slotSetup.add(setup);
+}
+
+void BakedAnimation::setFrame(size_t frame, Skeleton &skeleton) {
+	float *values = _values.buffer() + frame * getValueCount();
+	SkeletonPose &pose = skeleton.getPose();
+	for (size_t i = 0, n = _bones.size(); i < n; i++)
+		*values++ = pose.getChannel((PoseChannel) _boneChannels[i])[_bones[i]];
+	Vector<Slot *> &slots = skeleton.getSlots();
+	for (size_t i = 0, n = _slots.size(); i < n; i++)
+		*values++ = getSlotValue(*slots[_slots[i]], _slotChannels[i]);
+}
+
+float &BakedAnimation::getSlotValue(Slot &slot, int component) {
+	Color &color = component < 4 ? slot.getColor() : slot.getDarkColor();
+	switch (component) {
+		case 0:
+		case 4:
+			return color.r;
+		case 1:
+		case 5:
+			return color.g;
+		case 2:
+		case 6:
+			return color.b;
+		default:
+			return color.a;
+	}
+}
+
+Animation &BakedAnimation::getAnimation() {
+	return _animation;
+}
+
+float BakedAnimation::getDuration() {
+	return _animation.getDuration();
+}
+
+float BakedAnimation::getFrameRate() {
+	return _frameRate;
+}
+
+size_t BakedAnimation::getFrameCount() {
+	return _frameCount;
+}
+
+float BakedAnimation::getFrameInterval() {
+	return _frameInterval;
+}
+
+Vector<Timeline *> &BakedAnimation::getTimelines() {
+	return _timelines;
+}
+
+size_t BakedAnimation::getValueCount() {
+	return _bones.size() + _slots.size();
+}
@@ -0,0 +1,214 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/BoneKernel.h>
+
+#include <spine/MathUtil.h>
+#include <spine/SkeletonPose.h>
+#include <spine/Simd.h>
+
+#include <string.h>
+
+using namespace spine;
+
+namespace {
+	/// One bone per lane: inputs are the applied local transform and the parent's world transform.
+	struct NormalLanes {
+		float x[BoneKernel::Width], y[BoneKernel::Width];
+		// The X rotations of all lanes followed by the Y rotations, so one MathUtil::sinCosDeg call covers both.
+		float rotation[BoneKernel::Width * 2], sine[BoneKernel::Width * 2], cosine[BoneKernel::Width * 2];
+		float scaleX[BoneKernel::Width], scaleY[BoneKernel::Width];
+		float pa[BoneKernel::Width], pb[BoneKernel::Width], pc[BoneKernel::Width], pd[BoneKernel::Width];
+		float pworldX[BoneKernel::Width], pworldY[BoneKernel::Width];
+		float a[BoneKernel::Width], b[BoneKernel::Width], c[BoneKernel::Width], d[BoneKernel::Width];
+		float worldX[BoneKernel::Width], worldY[BoneKernel::Width];
+	};
+
+#if defined(SPINE_SIMD_SSE)
+	void computeNormal(NormalLanes &l) {
+		__m128 cosX = _mm_loadu_ps(l.cosine), sinX = _mm_loadu_ps(l.sine);
+		__m128 cosY = _mm_loadu_ps(l.cosine + BoneKernel::Width), sinY = _mm_loadu_ps(l.sine + BoneKernel::Width);
+		__m128 pa = _mm_loadu_ps(l.pa), pb = _mm_loadu_ps(l.pb), pc = _mm_loadu_ps(l.pc), pd = _mm_loadu_ps(l.pd);
+		__m128 x = _mm_loadu_ps(l.x), y = _mm_loadu_ps(l.y);
+		__m128 scaleX = _mm_loadu_ps(l.scaleX), scaleY = _mm_loadu_ps(l.scaleY);
+		__m128 la = _mm_mul_ps(cosX, scaleX);
+		__m128 lb = _mm_mul_ps(cosY, scaleY);
+		__m128 lc = _mm_mul_ps(sinX, scaleX);
+		__m128 ld = _mm_mul_ps(sinY, scaleY);
+		_mm_storeu_ps(l.worldX, _mm_add_ps(_mm_add_ps(_mm_mul_ps(pa, x), _mm_mul_ps(pb, y)), _mm_loadu_ps(l.pworldX)));
+		_mm_storeu_ps(l.worldY, _mm_add_ps(_mm_add_ps(_mm_mul_ps(pc, x), _mm_mul_ps(pd, y)), _mm_loadu_ps(l.pworldY)));
+		_mm_storeu_ps(l.a, _mm_add_ps(_mm_mul_ps(pa, la), _mm_mul_ps(pb, lc)));
+		_mm_storeu_ps(l.b, _mm_add_ps(_mm_mul_ps(pa, lb), _mm_mul_ps(pb, ld)));
+		_mm_storeu_ps(l.c, _mm_add_ps(_mm_mul_ps(pc, la), _mm_mul_ps(pd, lc)));
+		_mm_storeu_ps(l.d, _mm_add_ps(_mm_mul_ps(pc, lb), _mm_mul_ps(pd, ld)));
+	}
+#elif defined(SPINE_SIMD_NEON)
+	void computeNormal(NormalLanes &l) {
+		float32x4_t cosX = vld1q_f32(l.cosine), sinX = vld1q_f32(l.sine);
+		float32x4_t cosY = vld1q_f32(l.cosine + BoneKernel::Width), sinY = vld1q_f32(l.sine + BoneKernel::Width);
+		float32x4_t pa = vld1q_f32(l.pa), pb = vld1q_f32(l.pb), pc = vld1q_f32(l.pc), pd = vld1q_f32(l.pd);
+		float32x4_t x = vld1q_f32(l.x), y = vld1q_f32(l.y);
+		float32x4_t scaleX = vld1q_f32(l.scaleX), scaleY = vld1q_f32(l.scaleY);
+		float32x4_t la = vmulq_f32(cosX, scaleX);
+		float32x4_t lb = vmulq_f32(cosY, scaleY);
+		float32x4_t lc = vmulq_f32(sinX, scaleX);
+		float32x4_t ld = vmulq_f32(sinY, scaleY);
+		vst1q_f32(l.worldX, vaddq_f32(vaddq_f32(vmulq_f32(pa, x), vmulq_f32(pb, y)), vld1q_f32(l.pworldX)));
+		vst1q_f32(l.worldY, vaddq_f32(vaddq_f32(vmulq_f32(pc, x), vmulq_f32(pd, y)), vld1q_f32(l.pworldY)));
+		vst1q_f32(l.a, vaddq_f32(vmulq_f32(pa, la), vmulq_f32(pb, lc)));
+		vst1q_f32(l.b, vaddq_f32(vmulq_f32(pa, lb), vmulq_f32(pb, ld)));
+		vst1q_f32(l.c, vaddq_f32(vmulq_f32(pc, la), vmulq_f32(pd, lc)));
+		vst1q_f32(l.d, vaddq_f32(vmulq_f32(pc, lb), vmulq_f32(pd, ld)));
+	}
+#else
+	void computeNormal(NormalLanes &l) {
+		for (int i = 0; i < BoneKernel::Width; i++) {
+			float cosX = l.cosine[i], sinX = l.sine[i];
+			float cosY = l.cosine[BoneKernel::Width + i], sinY = l.sine[BoneKernel::Width + i];
+			float pa = l.pa[i], pb = l.pb[i], pc = l.pc[i], pd = l.pd[i];
+			float la = cosX * l.scaleX[i];
+			float lb = cosY * l.scaleY[i];
+			float lc = sinX * l.scaleX[i];
+			float ld = sinY * l.scaleY[i];
+			l.worldX[i] = pa * l.x[i] + pb * l.y[i] + l.pworldX[i];
+			l.worldY[i] = pc * l.x[i] + pd * l.y[i] + l.pworldY[i];
+			l.a[i] = pa * la + pb * lc;
+			l.b[i] = pa * lb + pb * ld;
+			l.c[i] = pc * la + pd * lc;
+			l.d[i] = pc * lb + pd * ld;
+		}
+	}
+#endif
+}
+
+void BoneKernel::updateNormal(SkeletonPose &pose, const int *bones, const int *parents, const size_t *levelEnds,
+							  size_t levelCount) {
+	const float *ax = pose.getChannel(PoseChannel_AX), *ay = pose.getChannel(PoseChannel_AY);
+	const float *arotation = pose.getChannel(PoseChannel_ARotation);
+	const float *ascaleX = pose.getChannel(PoseChannel_AScaleX), *ascaleY = pose.getChannel(PoseChannel_AScaleY);
+	const float *ashearX = pose.getChannel(PoseChannel_AShearX), *ashearY = pose.getChannel(PoseChannel_AShearY);
+	float *a = pose.getChannel(PoseChannel_A), *b = pose.getChannel(PoseChannel_B);
+	float *c = pose.getChannel(PoseChannel_C), *d = pose.getChannel(PoseChannel_D);
+	float *worldX = pose.getChannel(PoseChannel_WorldX), *worldY = pose.getChannel(PoseChannel_WorldY);
+
+	NormalLanes l;
+	memset(&l, 0, sizeof(l));
+	for (size_t level = 0, start = 0; level < levelCount; level++) {
+		size_t end = levelEnds[level];
+		while (start < end) {
+			// Unused lanes keep finite values from earlier iterations and are never stored.
+			int lanes = end - start < (size_t) Width ? (int) (end - start) : Width;
+			for (int i = 0; i < lanes; i++) {
+				int bone = bones[start + i], parent = parents[start + i];
+				float rotation = arotation[bone];
+				l.rotation[i] = rotation + ashearX[bone];
+				l.rotation[Width + i] = rotation + 90 + ashearY[bone];
+				l.x[i] = ax[bone];
+				l.y[i] = ay[bone];
+				l.scaleX[i] = ascaleX[bone];
+				l.scaleY[i] = ascaleY[bone];
+				l.pa[i] = a[parent];
+				l.pb[i] = b[parent];
+				l.pc[i] = c[parent];
+				l.pd[i] = d[parent];
+				l.pworldX[i] = worldX[parent];
+				l.pworldY[i] = worldY[parent];
+			}
+			if (lanes == Width)
+				MathUtil::sinCosDeg(l.rotation, l.sine, l.cosine, Width * 2);
+			else {
+				MathUtil::sinCosDeg(l.rotation, l.sine, l.cosine, lanes);
+				MathUtil::sinCosDeg(l.rotation + Width, l.sine + Width, l.cosine + Width, lanes);
+			}
+			computeNormal(l);
+			for (int i = 0; i < lanes; i++) {
+				int bone = bones[start + i];
+				a[bone] = l.a[i];
+				b[bone] = l.b[i];
+				c[bone] = l.c[i];
+				d[bone] = l.d[i];
+				worldX[bone] = l.worldX[i];
+				worldY[bone] = l.worldY[i];
+			}
+			start += lanes;
+		}
+	}
+}
+
+void BoneKernel::updateNormalInstances(SkeletonPose **poses, size_t poseCount, const int *bones, const int *parents,
+									   size_t boneCount) {
+	if (poseCount == 0) return;
+	size_t stride = poses[0]->getStride();
+
+	NormalLanes l;
+	memset(&l, 0, sizeof(l));
+	float *buffers[Width];
+	// Chunks of Width poses go through all bones before the next chunk, so the chunk's poses stay in cache.
+	for (size_t start = 0; start < poseCount; start += Width) {
+		// Unused lanes keep finite values from earlier iterations and are never stored.
+		int lanes = poseCount - start < (size_t) Width ? (int) (poseCount - start) : Width;
+		for (int ii = 0; ii < lanes; ii++)
+			buffers[ii] = poses[start + ii]->getChannel(PoseChannel_X);
+		for (size_t i = 0; i < boneCount; i++) {
+			int bone = bones[i], parent = parents[i];
+			for (int ii = 0; ii < lanes; ii++) {
+				float *buffer = buffers[ii];
+				float rotation = buffer[PoseChannel_ARotation * stride + bone];
+				l.rotation[ii] = rotation + buffer[PoseChannel_AShearX * stride + bone];
+				l.rotation[Width + ii] = rotation + 90 + buffer[PoseChannel_AShearY * stride + bone];
+				l.x[ii] = buffer[PoseChannel_AX * stride + bone];
+				l.y[ii] = buffer[PoseChannel_AY * stride + bone];
+				l.scaleX[ii] = buffer[PoseChannel_AScaleX * stride + bone];
+				l.scaleY[ii] = buffer[PoseChannel_AScaleY * stride + bone];
+				l.pa[ii] = buffer[PoseChannel_A * stride + parent];
+				l.pb[ii] = buffer[PoseChannel_B * stride + parent];
+				l.pc[ii] = buffer[PoseChannel_C * stride + parent];
+				l.pd[ii] = buffer[PoseChannel_D * stride + parent];
+				l.pworldX[ii] = buffer[PoseChannel_WorldX * stride + parent];
+				l.pworldY[ii] = buffer[PoseChannel_WorldY * stride + parent];
+			}
+			if (lanes == Width)
+				MathUtil::sinCosDeg(l.rotation, l.sine, l.cosine, Width * 2);
+			else {
+				MathUtil::sinCosDeg(l.rotation, l.sine, l.cosine, lanes);
+				MathUtil::sinCosDeg(l.rotation + Width, l.sine + Width, l.cosine + Width, lanes);
+			}
+			computeNormal(l);
+			for (int ii = 0; ii < lanes; ii++) {
+				float *buffer = buffers[ii];
+				buffer[PoseChannel_A * stride + bone] = l.a[ii];
+				buffer[PoseChannel_B * stride + bone] = l.b[ii];
+				buffer[PoseChannel_C * stride + bone] = l.c[ii];
+				buffer[PoseChannel_D * stride + bone] = l.d[ii];
+				buffer[PoseChannel_WorldX * stride + bone] = l.worldX[ii];
+				buffer[PoseChannel_WorldY * stride + bone] = l.worldY[ii];
+			}
+		}
+	}
+}
@@ -55,7 +55,7 @@ RGBATimeline::~RGBATimeline() {
 }
 
 void RGBATimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						 MixBlend blend, MixDirection direction) {
+						 MixBlend blend, MixDirection direction, int *searchCursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -79,7 +79,7 @@ void RGBATimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<
 	}
 
 	float r = 0, g = 0, b = 0, a = 0;
-	int i = Animation::search(_frames, time, RGBATimeline::ENTRIES);
+	int i = Animation::search(_frames, time, RGBATimeline::ENTRIES, searchCursor);
 	int curveType = (int) _curves[i / RGBATimeline::ENTRIES];
 	switch (curveType) {
 		case RGBATimeline::LINEAR: {
@@ -144,7 +144,7 @@ RGBTimeline::~RGBTimeline() {
 }
 
 void RGBTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						MixBlend blend, MixDirection direction) {
+						MixBlend blend, MixDirection direction, int *searchCursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -168,7 +168,7 @@ void RGBTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<E
 	}
 
 	float r = 0, g = 0, b = 0;
-	int i = Animation::search(_frames, time, RGBTimeline::ENTRIES);
+	int i = Animation::search(_frames, time, RGBTimeline::ENTRIES, searchCursor);
 	int curveType = (int) _curves[i / RGBTimeline::ENTRIES];
 	switch (curveType) {
 		case RGBTimeline::LINEAR: {
@@ -227,7 +227,7 @@ AlphaTimeline::~AlphaTimeline() {
 }
 
 void AlphaTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						  MixBlend blend, MixDirection direction) {
+						  MixBlend blend, MixDirection direction, int *searchCursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -249,7 +249,7 @@ void AlphaTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 		return;
 	}
 
-	float a = getCurveValue(time);
+	float a = getCurveValue(time, searchCursor);
 	if (alpha == 1)
 		slot->_color.a = a;
 	else {
@@ -274,7 +274,7 @@ RGBA2Timeline::~RGBA2Timeline() {
 }
 
 void RGBA2Timeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						  MixBlend blend, MixDirection direction) {
+						  MixBlend blend, MixDirection direction, int *searchCursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -303,7 +303,7 @@ void RGBA2Timeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	}
 
 	float r = 0, g = 0, b = 0, a = 0, r2 = 0, g2 = 0, b2 = 0;
-	int i = Animation::search(_frames, time, RGBA2Timeline::ENTRIES);
+	int i = Animation::search(_frames, time, RGBA2Timeline::ENTRIES, searchCursor);
 	int curveType = (int) _curves[i / RGBA2Timeline::ENTRIES];
 	switch (curveType) {
 		case RGBA2Timeline::LINEAR: {
@@ -394,7 +394,7 @@ RGB2Timeline::~RGB2Timeline() {
 }
 
 void RGB2Timeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						 MixBlend blend, MixDirection direction) {
+						 MixBlend blend, MixDirection direction, int *searchCursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -422,7 +422,7 @@ void RGB2Timeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<
 	}
 
 	float r = 0, g = 0, b = 0, r2 = 0, g2 = 0, b2 = 0;
-	int i = Animation::search(_frames, time, RGB2Timeline::ENTRIES);
+	int i = Animation::search(_frames, time, RGB2Timeline::ENTRIES, searchCursor);
 	int curveType = (int) _curves[i / RGB2Timeline::ENTRIES];
 	switch (curveType) {
 		case RGB2Timeline::LINEAR: {
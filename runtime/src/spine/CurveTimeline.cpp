@@ -29,14 +29,73 @@
 
 #include <spine/CurveTimeline.h>
 
+#include <spine/Animation.h>
 #include <spine/MathUtil.h>
 
 using namespace spine;
 
 RTTI_IMPL(CurveTimeline, Timeline)
 
+const float CurveTimeline::MaxBezierTableError = 0.005f;
+
+/// Evaluates a bezier curve the same way as CurveTimeline::getBezierValue(), computing its points only up to the time.
+static float evaluateBezier(float time, float time1, float value1, float cx1, float cy1, float cx2, float cy2,
+							float time2, float value2) {
+	float tmpx = (time1 - cx1 * 2 + cx2) * 0.03, tmpy = (value1 - cy1 * 2 + cy2) * 0.03;
+	float dddx = ((cx1 - cx2) * 3 - time1 + time2) * 0.006, dddy = ((cy1 - cy2) * 3 - value1 + value2) * 0.006;
+	float ddx = tmpx * 2 + dddx, ddy = tmpy * 2 + dddy;
+	float dx = (cx1 - time1) * 0.3 + tmpx + dddx * 0.16666667, dy = (cy1 - value1) * 0.3 + tmpy + dddy * 0.16666667;
+	float x = time1 + dx, y = value1 + dy;
+	if (x > time) return value1 + (time - time1) / (x - time1) * (y - value1);
+	for (int i = 1; i < 9; i++) {
+		float px = x, py = y;
+		dx += ddx;
+		dy += ddy;
+		ddx += dddx;
+		ddy += dddy;
+		x += dx;
+		y += dy;
+		if (x >= time) return py + (time - px) / (x - px) * (y - py);
+	}
+	return y + (time - x) / (time2 - x) * (value2 - y);
+}
+
+/// Finds the parameter of a bezier curve at a time with Newton's method, bisecting instead when a step leaves the interval
+/// known to hold the parameter. The curve's time must increase with its parameter.
+static float findBezierParameter(float time, float time1, float cx1, float cx2, float time2, float t) {
+	float low = 0, high = 1, tolerance = (time2 - time1) * 1e-6f;
+	for (int i = 0; i < 24; i++) {
+		float u = 1 - t;
+		float error = u * u * u * time1 + 3 * u * u * t * cx1 + 3 * u * t * t * cx2 + t * t * t * time2 - time;
+		if (error < 0) {
+			if (error > -tolerance) break;
+			low = t;
+		} else {
+			if (error < tolerance) break;
+			high = t;
+		}
+		float slope = 3 * (u * u * (cx1 - time1) + 2 * u * t * (cx2 - cx1) + t * t * (time2 - cx2));
+		float next = slope > 0 ? t - error / slope : -1;
+		t = next > low && next < high ? next : (low + high) * 0.5f;
+	}
+	return t;
+}
+
+static float getBezierPoint(float t, float value1, float cy1, float cy2, float value2) {
+	float u = 1 - t;
+	return u * u * u * value1 + 3 * u * u * t * cy1 + 3 * u * t * t * cy2 + t * t * t * value2;
+}
+
+static unsigned short quantizeValue(float value) {
+	return (unsigned short) (MathUtil::clamp(value, 0, 1) * 65535 + 0.5f);
+}
+
 CurveTimeline::CurveTimeline(size_t frameCount, size_t frameEntries, size_t bezierCount) : Timeline(frameCount,
-																									frameEntries) {
+																									frameEntries),
+																						   _curveTimeOffset(0),
+																						   _curveTimeScale(0),
+																						   _curveOffset(0),
+																						   _curveScale(0) {
 	_curves.setSize(frameCount + bezierCount * BEZIER_SIZE, 0);
 	_curves[frameCount - 1] = STEPPED;
 }
@@ -56,44 +115,279 @@ void CurveTimeline::setBezier(size_t bezier, size_t frame, float value, float ti
 							  float cx2, float cy2, float time2, float value2) {
 	size_t i = getFrameCount() + bezier * BEZIER_SIZE;
 	if (value == 0) _curves[frame] = BEZIER + i;
-	float tmpx = (time1 - cx1 * 2 + cx2) * 0.03, tmpy = (value1 - cy1 * 2 + cy2) * 0.03;
-	float dddx = ((cx1 - cx2) * 3 - time1 + time2) * 0.006, dddy = ((cy1 - cy2) * 3 - value1 + value2) * 0.006;
-	float ddx = tmpx * 2 + dddx, ddy = tmpy * 2 + dddy;
-	float dx = (cx1 - time1) * 0.3 + tmpx + dddx * 0.16666667, dy = (cy1 - value1) * 0.3 + tmpy + dddy * 0.16666667;
-	float x = time1 + dx, y = value1 + dy;
-	for (size_t n = i + BEZIER_SIZE; i < n; i += 2) {
-		_curves[i] = x;
-		_curves[i + 1] = y;
-		dx += ddx;
-		dy += ddy;
-		ddx += dddx;
-		ddy += dddy;
-		x += dx;
-		y += dy;
+	setBezierTable(&_curves[i], time1, value1, cx1, cy1, cx2, cy2, time2, value2);
+}
+
+float CurveTimeline::getBezierTableValue(const float *table, float time, float time1, float value1, float value2) {
+	float segment = (time - time1) * table[0];
+	if (segment < 0) {
+		// The table isn't accurate enough for the curve, compute it exactly.
+		float interval = BEZIER_SEGMENTS / -table[0];
+		float t = findBezierParameter(time, time1, table[BEZIER_CONTROLS], table[BEZIER_CONTROLS + 2], time1 + interval,
+									  MathUtil::clamp((time - time1) / interval, 0, 1));
+		return getBezierPoint(t, value1, table[BEZIER_CONTROLS + 1], table[BEZIER_CONTROLS + 3], value2);
 	}
+	int i = (int) segment;
+	if (i > BEZIER_SEGMENTS - 1) i = BEZIER_SEGMENTS - 1;
+	float before = i == 0 ? value1 : table[BEZIER_VALUES + i - 1];
+	float after = i == BEZIER_SEGMENTS - 1 ? value2 : table[BEZIER_VALUES + i];
+	return before + (segment - i) * (after - before);
 }
 
 float CurveTimeline::getBezierValue(float time, size_t frameIndex, size_t valueOffset, size_t i) {
-	if (_curves[i] > time) {
-		float x = _frames[frameIndex], y = _frames[frameIndex + valueOffset];
-		return y + (time - x) / (_curves[i] - x) * (_curves[i + 1] - y);
+	if (_quantizedCurves.size() > 0) {
+		const unsigned short *controls = &_quantizedCurves[(i - getFrameCount()) / BEZIER_SIZE * 4];
+		size_t nextIndex = frameIndex + getFrameEntries();
+		float time1 = _frames[frameIndex], time2 = _frames[nextIndex], interval = time2 - time1;
+		float cx1 = time1 + (_curveTimeOffset + controls[0] * _curveTimeScale) * interval;
+		float cx2 = time1 + (_curveTimeOffset + controls[2] * _curveTimeScale) * interval;
+		return evaluateBezier(time, time1, _frames[frameIndex + valueOffset], cx1, _curveOffset + controls[1] * _curveScale,
+							  cx2, _curveOffset + controls[3] * _curveScale, time2, _frames[nextIndex + valueOffset]);
 	}
-	size_t n = i + BEZIER_SIZE;
-	for (i += 2; i < n; i += 2) {
-		if (_curves[i] >= time) {
-			float x = _curves[i - 2], y = _curves[i - 1];
-			return y + (time - x) / (_curves[i] - x) * (_curves[i + 1] - y);
+	const float *frames = _frames.buffer();
+	return getBezierTableValue(&_curves[i], time, frames[frameIndex], frames[frameIndex + valueOffset],
+							   frames[frameIndex + _frameEntries + valueOffset]);
+}
+
+void CurveTimeline::setBezierTable(float *table, float time1, float value1, float cx1, float cy1, float cx2, float cy2,
+								   float time2, float value2) {
+	float interval = time2 - time1;
+	table[0] = interval > 0 ? BEZIER_SEGMENTS / interval : 0;
+	table[BEZIER_CONTROLS] = cx1;
+	table[BEZIER_CONTROLS + 1] = cy1;
+	table[BEZIER_CONTROLS + 2] = cx2;
+	table[BEZIER_CONTROLS + 3] = cy2;
+	if (interval <= 0) return;
+
+	// Sample the curve at uniform times, so evaluating it is a lerp without a search. The curve is walked with forward
+	// differencing at BEZIER_TABLE_STEPS uniform parameters, reading the value at each sample time and midway between two
+	// samples from the points around it. The lerp between samples is checked against the value midway: curves changing
+	// too sharply for the table are computed exactly when evaluated instead, marked by a negative segment count.
+	float step = 1.0f / BEZIER_TABLE_STEPS, step2 = step * step, step3 = step2 * step;
+	float ax = time2 - time1 + (cx1 - cx2) * 3, bx = (time1 - cx1 * 2 + cx2) * 3, ay = value2 - value1 + (cy1 - cy2) * 3,
+			by = (value1 - cy1 * 2 + cy2) * 3;
+	float dx = ax * step3 + bx * step2 + (cx1 - time1) * 3 * step, ddx = ax * 6 * step3 + bx * 2 * step2,
+			dddx = ax * 6 * step3;
+	float dy = ay * step3 + by * step2 + (cy1 - value1) * 3 * step, ddy = ay * 6 * step3 + by * 2 * step2,
+			dddy = ay * 6 * step3;
+	float x = time1, y = value1, nextX = x + dx, nextY = y + dy;
+	int points = 1;
+
+	float range = MathUtil::max(MathUtil::max(value1, value2), MathUtil::max(cy1, cy2)) -
+				  MathUtil::min(MathUtil::min(value1, value2), MathUtil::min(cy1, cy2));
+	float tolerance = range * MaxBezierTableError, before = value1, middle = value1;
+	bool exact = false;
+	for (int half = 1; half < BEZIER_SEGMENTS * 2; half++) {
+		float time = time1 + interval * half / (BEZIER_SEGMENTS * 2);
+		while (nextX < time && points < BEZIER_TABLE_STEPS) {
+			x = nextX;
+			y = nextY;
+			dx += ddx;
+			dy += ddy;
+			ddx += dddx;
+			ddy += dddy;
+			nextX += dx;
+			nextY += dy;
+			points++;
+		}
+		if (points == BEZIER_TABLE_STEPS) {
+			nextX = time2;
+			nextY = value2;
+		}
+		float value = nextX > x ? y + (time - x) / (nextX - x) * (nextY - y) : nextY;
+		if (half & 1) {
+			middle = value;
+			continue;
 		}
+		table[BEZIER_VALUES + (half >> 1) - 1] = value;
+		if (MathUtil::abs((before + value) * 0.5f - middle) > tolerance) exact = true;
+		before = value;
 	}
-	frameIndex += getFrameEntries();
-	float x = _curves[n - 2], y = _curves[n - 1];
-	return y + (time - x) / (_frames[frameIndex] - x) * (_frames[frameIndex + valueOffset] - y);
+	if (MathUtil::abs((before + value2) * 0.5f - middle) > tolerance) exact = true;
+	if (exact) table[0] = -table[0];
 }
 
 Vector<float> &CurveTimeline::getCurves() {
 	return _curves;
 }
 
+bool CurveTimeline::hasSteppedFrames() {
+	for (size_t i = 0, n = getFrameCount() - 1; i < n; i++)
+		if (_curves[i] == STEPPED) return true;
+	return false;
+}
+
+size_t CurveTimeline::countBeziers(size_t &valueCount) {
+	size_t frameCount = getFrameCount();
+
+	// Loaders may reserve more beziers than they use. A bezier frame has one bezier per value following the frame time,
+	// except for values that are never interpolated, which come last.
+	size_t lastBezier = 0;
+	bool hasBezier = false;
+	valueCount = MathUtil::max((size_t) 1, getFrameEntries() - 1);
+	for (size_t frame = 0; frame < frameCount - 1; frame++) {
+		int curveType = (int) _curves[frame];
+		if (curveType < BEZIER) continue;
+		size_t bezier = (curveType - BEZIER - frameCount) / BEZIER_SIZE;
+		if (hasBezier) valueCount = MathUtil::min(valueCount, bezier - lastBezier);
+		lastBezier = bezier;
+		hasBezier = true;
+	}
+	if (!hasBezier) return 0;
+	return lastBezier + MathUtil::min(valueCount, (_curves.size() - frameCount) / BEZIER_SIZE - lastBezier);
+}
+
+void CurveTimeline::quantize() {
+	if (_quantizedCurves.size() > 0) return;
+	size_t frameCount = getFrameCount(), frameEntries = getFrameEntries();
+
+	size_t valueCount, bezierCount = countBeziers(valueCount);
+	if (bezierCount > 0) {
+		Vector<float> controls;
+		controls.setSize(bezierCount * 4, 0);
+		float low = 0, high = 0, timeLow = 0, timeHigh = 0;
+		bool first = true;
+		for (size_t frame = 0; frame < frameCount - 1; frame++) {
+			int curveType = (int) _curves[frame];
+			if (curveType < BEZIER) continue;
+			size_t frameIndex = frame * frameEntries, nextIndex = frameIndex + frameEntries;
+			float time1 = _frames[frameIndex], time2 = _frames[nextIndex], interval = time2 - time1;
+			for (size_t value = 0; value < valueCount; value++) {
+				size_t i = curveType - BEZIER + value * BEZIER_SIZE, c = (i - frameCount) / BEZIER_SIZE * 4;
+				if (c >= controls.size()) break;
+				float cx1 = _curves[i + BEZIER_CONTROLS], cy1 = _curves[i + BEZIER_CONTROLS + 1];
+				float cx2 = _curves[i + BEZIER_CONTROLS + 2], cy2 = _curves[i + BEZIER_CONTROLS + 3];
+				controls[c] = interval > 0 ? (cx1 - time1) / interval : 0;
+				controls[c + 1] = cy1;
+				controls[c + 2] = interval > 0 ? (cx2 - time1) / interval : 0;
+				controls[c + 3] = cy2;
+				if (first) {
+					timeLow = timeHigh = controls[c];
+					low = high = cy1;
+					first = false;
+				}
+				timeLow = MathUtil::min(timeLow, MathUtil::min(controls[c], controls[c + 2]));
+				timeHigh = MathUtil::max(timeHigh, MathUtil::max(controls[c], controls[c + 2]));
+				low = MathUtil::min(low, MathUtil::min(cy1, cy2));
+				high = MathUtil::max(high, MathUtil::max(cy1, cy2));
+			}
+		}
+
+		_curveTimeOffset = timeLow;
+		_curveTimeScale = (timeHigh - timeLow) / 65535;
+		_curveOffset = low;
+		_curveScale = (high - low) / 65535;
+		float timeRange = timeHigh > timeLow ? timeHigh - timeLow : 1, range = high > low ? high - low : 1;
+		_quantizedCurves.setSize(bezierCount * 4, 0);
+		for (size_t i = 0, n = bezierCount * 4; i < n; i += 2) {
+			_quantizedCurves[i] = quantizeValue((controls[i] - timeLow) / timeRange);
+			_quantizedCurves[i + 1] = quantizeValue((controls[i + 1] - low) / range);
+		}
+		_quantizedCurves.shrinkToFit();
+	}
+	_curves.setSize(frameCount, 0);
+	_curves.shrinkToFit();
+	_frames.shrinkToFit();
+}
+
+bool CurveTimeline::isQuantized() {
+	return _quantizedCurves.size() > 0;
+}
+
+size_t CurveTimeline::getByteCount() {
+	return _frames.getCapacity() * sizeof(float) + _curves.getCapacity() * sizeof(float) +
+		   _quantizedCurves.getCapacity() * sizeof(unsigned short);
+}
+
+size_t CurveTimeline::removeRedundantFrames(Vector<Timeline *> &timelines, float rotateTolerance,
+										   float translateTolerance) {
+	if (rotateTolerance < 0 && translateTolerance < 0) return 0;
+	size_t removed = 0;
+	for (size_t i = 0; i < timelines.size(); i++) {
+		if (!timelines[i]->getRTTI().instanceOf(CurveTimeline::rtti)) continue;
+		Vector<PropertyId> &ids = timelines[i]->getPropertyIds();
+		bool rotate = true, translate = true;
+		for (size_t ii = 0; ii < ids.size(); ii++) {
+			int property = (int) (ids[ii] >> 32);
+			rotate = rotate && (property == Property_Rotate || property == Property_ShearX || property == Property_ShearY);
+			translate = translate && (property == Property_X || property == Property_Y);
+		}
+		float tolerance = rotate ? rotateTolerance : (translate ? translateTolerance : -1);
+		if (tolerance < 0) continue;
+		removed += static_cast<CurveTimeline *>(timelines[i])->removeRedundantFrames(tolerance);
+	}
+	return removed;
+}
+
+size_t CurveTimeline::removeRedundantFrames(float tolerance) {
+	if (isQuantized()) return 0;
+	size_t frameCount = getFrameCount(), frameEntries = getFrameEntries();
+	if (frameCount < 3) return 0;
+
+	// A frame is redundant when the linear or stepped frame before it, the anchor, reaches the frame after it with the
+	// frames in between within tolerance. Bezier frames are kept, so their curves don't change.
+	Vector<bool> keep;
+	keep.setSize(frameCount, true);
+	size_t removed = 0;
+	for (size_t anchor = 0, frame = 1; frame < frameCount - 1; frame++) {
+		int curveType = (int) _curves[anchor];
+		size_t anchorIndex = anchor * frameEntries, nextIndex = (frame + 1) * frameEntries;
+		bool redundant = curveType < BEZIER && (int) _curves[frame] == curveType &&
+						 _frames[nextIndex] > _frames[anchorIndex];
+		for (size_t i = anchor + 1; redundant && i <= frame; i++) {
+			size_t index = i * frameEntries;
+			float percent = curveType == STEPPED ? 0 :
+							(_frames[index] - _frames[anchorIndex]) / (_frames[nextIndex] - _frames[anchorIndex]);
+			for (size_t value = 1; value < frameEntries; value++) {
+				float start = _frames[anchorIndex + value];
+				float expected = start + (_frames[nextIndex + value] - start) * percent;
+				if (MathUtil::abs(_frames[index + value] - expected) > tolerance) {
+					redundant = false;
+					break;
+				}
+			}
+		}
+		if (redundant) {
+			keep[frame] = false;
+			removed++;
+		} else
+			anchor = frame;
+	}
+	if (removed == 0) return 0;
+
+	size_t valueCount, bezierCount = countBeziers(valueCount), newFrameCount = frameCount - removed;
+	size_t bezierFrames = 0;
+	for (size_t frame = 0; frame < frameCount - 1; frame++)
+		if (_curves[frame] >= BEZIER) bezierFrames++;
+
+	Vector<float> curves;
+	curves.setSize(newFrameCount + (bezierCount > 0 ? bezierFrames * valueCount * BEZIER_SIZE : 0), 0);
+	for (size_t frame = 0, newFrame = 0, bezier = 0; frame < frameCount; frame++) {
+		if (!keep[frame]) continue;
+		if (newFrame != frame) {
+			for (size_t i = 0; i < frameEntries; i++)
+				_frames[newFrame * frameEntries + i] = _frames[frame * frameEntries + i];
+		}
+		int curveType = (int) _curves[frame];
+		if (curveType >= BEZIER && frame < frameCount - 1) {
+			size_t i = curveType - BEZIER, newI = newFrameCount + bezier * BEZIER_SIZE;
+			size_t n = MathUtil::min(valueCount * BEZIER_SIZE, _curves.size() - i);
+			for (size_t ii = 0; ii < n; ii++)
+				curves[newI + ii] = _curves[i + ii];
+			curves[newFrame] = BEZIER + newI;
+			bezier += valueCount;
+		} else
+			curves[newFrame] = curveType;
+		newFrame++;
+	}
+	_frames.setSize(newFrameCount * frameEntries, 0);
+	_frames.shrinkToFit();
+	_curves.clear();
+	_curves.addAll(curves);
+	_curves.shrinkToFit();
+	return removed;
+}
+
 RTTI_IMPL(CurveTimeline1, CurveTimeline)
 
 CurveTimeline1::CurveTimeline1(size_t frameCount, size_t bezierCount) : CurveTimeline(frameCount,
@@ -110,15 +404,11 @@ void CurveTimeline1::setFrame(size_t frame, float time, float value) {
 	_frames[frame + CurveTimeline1::VALUE] = value;
 }
 
-float CurveTimeline1::getCurveValue(float time) {
-	int i = (int) _frames.size() - 2;
-	for (int ii = 2; ii <= i; ii += 2) {
-		if (_frames[ii] > time) {
-			i = ii - 2;
-			break;
-		}
-	}
+float CurveTimeline1::getCurveValue(float time, int *searchCursor) {
+	return getCurveValue(time, Animation::search(_frames, time, CurveTimeline1::ENTRIES, searchCursor));
+}
 
+float CurveTimeline1::getCurveValue(float time, int i) {
 	int curveType = (int) _curves[i >> 1];
 	switch (curveType) {
 		case CurveTimeline::LINEAR: {
@@ -148,3 +438,32 @@ void CurveTimeline2::setFrame(size_t frame, float time, float value1, float valu
 	_frames[frame + CurveTimeline2::VALUE1] = value1;
 	_frames[frame + CurveTimeline2::VALUE2] = value2;
 }
+
+void CurveTimeline2::getCurveValues(float time, float &value1, float &value2, int *searchCursor) {
+	getCurveValues(time, Animation::search(_frames, time, CurveTimeline2::ENTRIES, searchCursor), value1, value2);
+}
+
+void CurveTimeline2::getCurveValues(float time, int i, float &value1, float &value2) {
+	int curveType = (int) _curves[i / CurveTimeline2::ENTRIES];
+	switch (curveType) {
+		case CurveTimeline::LINEAR: {
+			float before = _frames[i];
+			value1 = _frames[i + CurveTimeline2::VALUE1];
+			value2 = _frames[i + CurveTimeline2::VALUE2];
+			float t = (time - before) / (_frames[i + CurveTimeline2::ENTRIES] - before);
+			value1 += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE1] - value1) * t;
+			value2 += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE2] - value2) * t;
+			break;
+		}
+		case CurveTimeline::STEPPED: {
+			value1 = _frames[i + CurveTimeline2::VALUE1];
+			value2 = _frames[i + CurveTimeline2::VALUE2];
+			break;
+		}
+		default: {
+			value1 = getBezierValue(time, i, CurveTimeline2::VALUE1, curveType - CurveTimeline::BEZIER);
+			value2 = getBezierValue(time, i, CurveTimeline2::VALUE2,
+									curveType + CurveTimeline::BEZIER_SIZE - CurveTimeline::BEZIER);
+		}
+	}
+}
@@ -36,6 +36,7 @@
 
 #include <spine/Animation.h>
 #include <spine/Bone.h>
+#include <spine/MathUtil.h>
 #include <spine/Property.h>
 #include <spine/Slot.h>
 #include <spine/SlotData.h>
@@ -49,15 +50,22 @@ DeformTimeline::DeformTimeline(size_t frameCount, size_t bezierCount, int slotIn
 	PropertyId ids[] = {((PropertyId) Property_Deform << 32) | ((slotIndex << 16 | attachment->_id) & 0xffffffff)};
 	setPropertyIds(ids, 1);
 
-	_vertices.ensureCapacity(frameCount);
+	_offsets.ensureCapacity(frameCount);
 	for (size_t i = 0; i < frameCount; ++i) {
 		Vector<float> vec;
-		_vertices.add(vec);
+		_offsets.add(vec);
 	}
+	_offsetStarts.setSize(frameCount, 0);
+}
+
+static inline float getOffset(Vector<float> &offsets, size_t start, size_t i) {
+	// Wraps around for i < start.
+	i -= start;
+	return i < offsets.size() ? offsets[i] : 0;
 }
 
 void DeformTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						   MixBlend blend, MixDirection direction) {
+						   MixBlend blend, MixDirection direction, int *searchCursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -81,8 +89,9 @@ void DeformTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 		blend = MixBlend_Setup;
 	}
 
-	Vector<Vector<float>> &vertices = _vertices;
-	size_t vertexCount = vertices[0].size();
+	Vector<float> &setupVertices = attachment->getVertices();
+	bool weighted = attachment->getBones().size() > 0;
+	size_t vertexCount = weighted ? setupVertices.size() / 3 * 2 : setupVertices.size();
 
 	Vector<float> &frames = _frames;
 	if (time < _frames[0]) {
@@ -97,9 +106,8 @@ void DeformTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 				}
 				deformArray.setSize(vertexCount, 0);
 				Vector<float> &deform = deformArray;
-				if (attachment->getBones().size() == 0) {
+				if (!weighted) {
 					// Unweighted vertex positions.
-					Vector<float> &setupVertices = attachment->getVertices();
 					for (size_t i = 0; i < vertexCount; i++)
 						deform[i] += (setupVertices[i] - deform[i]) * alpha;
 				} else {
@@ -117,142 +125,61 @@ void DeformTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	}
 
 	deformArray.setSize(vertexCount, 0);
-	Vector<float> &deform = deformArray;
+	float *deform = deformArray.buffer();
+	const float *setup = weighted ? NULL : setupVertices.buffer();
 
+	size_t frame, nextFrame;
+	float percent;
 	if (time >= frames[frames.size() - 1]) {// Time is after last frame.
-		Vector<float> &lastVertices = vertices[frames.size() - 1];
-		if (alpha == 1) {
-			if (blend == MixBlend_Add) {
-				VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-				if (vertexAttachment->getBones().size() == 0) {
-					// Unweighted vertex positions, no alpha.
-					Vector<float> &setupVertices = vertexAttachment->getVertices();
-					for (size_t i = 0; i < vertexCount; i++)
-						deform[i] += lastVertices[i] - setupVertices[i];
-				} else {
-					// Weighted deform offsets, no alpha.
-					for (size_t i = 0; i < vertexCount; i++)
-						deform[i] += lastVertices[i];
-				}
-			} else {
-				// Vertex positions or deform offsets, no alpha.
-				memcpy(deform.buffer(), lastVertices.buffer(), vertexCount * sizeof(float));
-			}
-		} else {
-			switch (blend) {
-				case MixBlend_Setup: {
-					VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-					if (vertexAttachment->getBones().size() == 0) {
-						// Unweighted vertex positions, with alpha.
-						Vector<float> &setupVertices = vertexAttachment->getVertices();
-						for (size_t i = 0; i < vertexCount; i++) {
-							float setup = setupVertices[i];
-							deform[i] = setup + (lastVertices[i] - setup) * alpha;
-						}
-					} else {
-						// Weighted deform offsets, with alpha.
-						for (size_t i = 0; i < vertexCount; i++)
-							deform[i] = lastVertices[i] * alpha;
-					}
-					break;
-				}
-				case MixBlend_First:
-				case MixBlend_Replace:
-					// Vertex positions or deform offsets, with alpha.
-					for (size_t i = 0; i < vertexCount; i++)
-						deform[i] += (lastVertices[i] - deform[i]) * alpha;
-					break;
-				case MixBlend_Add:
-					VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-					if (vertexAttachment->getBones().size() == 0) {
-						// Unweighted vertex positions, no alpha.
-						Vector<float> &setupVertices = vertexAttachment->getVertices();
-						for (size_t i = 0; i < vertexCount; i++)
-							deform[i] += (lastVertices[i] - setupVertices[i]) * alpha;
-					} else {
-						// Weighted deform offsets, alpha.
-						for (size_t i = 0; i < vertexCount; i++)
-							deform[i] += lastVertices[i] * alpha;
-					}
-			}
-		}
-		return;
+		frame = nextFrame = frames.size() - 1;
+		percent = 0;
+	} else {
+		frame = (size_t) Animation::search(frames, time, 1, searchCursor);
+		nextFrame = frame + 1;
+		percent = getCurvePercent(time, (int) frame);
 	}
 
-	// Interpolate between the previous frame and the current frame.
-	int frame = Animation::search(frames, time);
-	float percent = getCurvePercent(time, frame);
-	Vector<float> &prevVertices = vertices[frame];
-	Vector<float> &nextVertices = vertices[frame + 1];
-
-	if (alpha == 1) {
-		if (blend == MixBlend_Add) {
-			VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-			if (vertexAttachment->getBones().size() == 0) {
-				// Unweighted vertex positions, no alpha.
-				Vector<float> &setupVertices = vertexAttachment->getVertices();
-				for (size_t i = 0; i < vertexCount; i++) {
-					float prev = prevVertices[i];
-					deform[i] += prev + (nextVertices[i] - prev) * percent - setupVertices[i];
-				}
-			} else {
-				// Weighted deform offsets, no alpha.
-				for (size_t i = 0; i < vertexCount; i++) {
-					float prev = prevVertices[i];
-					deform[i] += prev + (nextVertices[i] - prev) * percent;
-				}
-			}
-		} else {
-			// Vertex positions or deform offsets, no alpha.
-			for (size_t i = 0; i < vertexCount; i++) {
-				float prev = prevVertices[i];
-				deform[i] = prev + (nextVertices[i] - prev) * percent;
-			}
+	// Only the vertices in the frames' ranges differ from the setup pose.
+	Vector<float> &prevOffsets = _offsets[frame], &nextOffsets = _offsets[nextFrame];
+	size_t prevStart = _offsetStarts[frame], nextStart = _offsetStarts[nextFrame];
+	size_t start = vertexCount, end = 0;
+	if (prevOffsets.size() > 0) {
+		start = prevStart;
+		end = prevStart + prevOffsets.size();
+	}
+	if (nextOffsets.size() > 0) {
+		start = MathUtil::min(start, nextStart);
+		end = MathUtil::max(end, nextStart + nextOffsets.size());
+	}
+	if (end > vertexCount) end = vertexCount;
+	if (start > end) start = end;
+
+	// Vertices outside the ranges are at the setup pose, which is 0 for weighted deform offsets.
+	if (blend == MixBlend_Add) {
+	} else if (alpha == 1 || blend == MixBlend_Setup) {
+		if (weighted)
+			memset(deform, 0, vertexCount * sizeof(float));
+		else
+			memcpy(deform, setup, vertexCount * sizeof(float));
+	} else {
+		// Vertex positions or deform offsets, with alpha.
+		for (size_t i = 0; i < start; i++)
+			deform[i] += ((weighted ? 0 : setup[i]) - deform[i]) * alpha;
+		for (size_t i = end; i < vertexCount; i++)
+			deform[i] += ((weighted ? 0 : setup[i]) - deform[i]) * alpha;
+	}
+
+	// Vertices inside the ranges. Unless mixing from the current pose, the setup pose is already in place.
+	if (blend == MixBlend_Add || alpha == 1 || blend == MixBlend_Setup) {
+		for (size_t i = start; i < end; i++) {
+			float prev = getOffset(prevOffsets, prevStart, i);
+			deform[i] += (prev + (getOffset(nextOffsets, nextStart, i) - prev) * percent) * alpha;
 		}
 	} else {
-		switch (blend) {
-			case MixBlend_Setup: {
-				VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-				if (vertexAttachment->getBones().size() == 0) {
-					// Unweighted vertex positions, with alpha.
-					Vector<float> &setupVertices = vertexAttachment->getVertices();
-					for (size_t i = 0; i < vertexCount; i++) {
-						float prev = prevVertices[i], setup = setupVertices[i];
-						deform[i] = setup + (prev + (nextVertices[i] - prev) * percent - setup) * alpha;
-					}
-				} else {
-					// Weighted deform offsets, with alpha.
-					for (size_t i = 0; i < vertexCount; i++) {
-						float prev = prevVertices[i];
-						deform[i] = (prev + (nextVertices[i] - prev) * percent) * alpha;
-					}
-				}
-				break;
-			}
-			case MixBlend_First:
-			case MixBlend_Replace:
-				// Vertex positions or deform offsets, with alpha.
-				for (size_t i = 0; i < vertexCount; i++) {
-					float prev = prevVertices[i];
-					deform[i] += (prev + (nextVertices[i] - prev) * percent - deform[i]) * alpha;
-				}
-				break;
-			case MixBlend_Add:
-				VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-				if (vertexAttachment->getBones().size() == 0) {
-					// Unweighted vertex positions, with alpha.
-					Vector<float> &setupVertices = vertexAttachment->getVertices();
-					for (size_t i = 0; i < vertexCount; i++) {
-						float prev = prevVertices[i];
-						deform[i] += (prev + (nextVertices[i] - prev) * percent - setupVertices[i]) * alpha;
-					}
-				} else {
-					// Weighted deform offsets, with alpha.
-					for (size_t i = 0; i < vertexCount; i++) {
-						float prev = prevVertices[i];
-						deform[i] += (prev + (nextVertices[i] - prev) * percent) * alpha;
-					}
-				}
+		for (size_t i = start; i < end; i++) {
+			float prev = getOffset(prevOffsets, prevStart, i);
+			float value = (weighted ? 0 : setup[i]) + prev + (getOffset(nextOffsets, nextStart, i) - prev) * percent;
+			deform[i] += (value - deform[i]) * alpha;
 		}
 	}
 }
@@ -263,21 +190,23 @@ void DeformTimeline::setBezier(size_t bezier, size_t frame, float value, float t
 	SP_UNUSED(value2);
 	size_t i = getFrameCount() + bezier * DeformTimeline::BEZIER_SIZE;
 	if (value == 0) _curves[frame] = DeformTimeline::BEZIER + i;
-	float tmpx = (time1 - cx1 * 2 + cx2) * 0.03, tmpy = cy2 * 0.03 - cy1 * 0.06;
-	float dddx = ((cx1 - cx2) * 3 - time1 + time2) * 0.006, dddy = (cy1 - cy2 + 0.33333333) * 0.018;
-	float ddx = tmpx * 2 + dddx, ddy = tmpy * 2 + dddy;
-	float dx = (cx1 - time1) * 0.3 + tmpx + dddx * 0.16666667, dy = cy1 * 0.3 + tmpy + dddy * 0.16666667;
-	float x = time1 + dx, y = dy;
-	for (size_t n = i + DeformTimeline::BEZIER_SIZE; i < n; i += 2) {
-		_curves[i] = x;
-		_curves[i + 1] = y;
-		dx += ddx;
-		dy += ddy;
-		ddx += dddx;
-		ddy += dddy;
-		x += dx;
-		y += dy;
-	}
+	setBezierTable(&_curves[i], time1, 0, cx1, cy1, cx2, cy2, time2, 1);
+}
+
+void DeformTimeline::quantize() {
+}
+
+size_t DeformTimeline::getByteCount() {
+	size_t count = CurveTimeline::getByteCount() + _offsets.getCapacity() * sizeof(Vector<float>) +
+				   _offsetStarts.getCapacity() * sizeof(size_t);
+	for (size_t i = 0, n = _offsets.size(); i < n; i++)
+		count += _offsets[i].getCapacity() * sizeof(float);
+	return count;
+}
+
+size_t DeformTimeline::removeRedundantFrames(float tolerance) {
+	SP_UNUSED(tolerance);
+	return 0;
 }
 
 float DeformTimeline::getCurvePercent(float time, int frame) {
@@ -293,30 +222,51 @@ float DeformTimeline::getCurvePercent(float time, int frame) {
 		default: {
 		}
 	}
-	i -= DeformTimeline::BEZIER;
-	if (_curves[i] > time) {
-		float x = _frames[frame];
-		return _curves[i + 1] * (time - x) / (_curves[i] - x);
-	}
-	int n = i + DeformTimeline::BEZIER_SIZE;
-	for (i += 2; i < n; i += 2) {
-		if (_curves[i] >= time) {
-			float x = _curves[i - 2], y = _curves[i - 1];
-			return y + (time - x) / (_curves[i] - x) * (_curves[i + 1] - y);
-		}
-	}
-	float x = _curves[n - 2], y = _curves[n - 1];
-	return y + (1 - y) * (time - x) / (_frames[frame + getFrameEntries()] - x);
+	return getBezierTableValue(&_curves[i - DeformTimeline::BEZIER], time, _frames[frame], 0, 1);
 }
 
 void DeformTimeline::setFrame(int frame, float time, Vector<float> &vertices) {
 	_frames[frame] = time;
-	_vertices[frame].clear();
-	_vertices[frame].addAll(vertices);
+
+	// Keep only the range that differs from the setup pose.
+	Vector<float> &setupVertices = _attachment->getVertices();
+	bool weighted = _attachment->getBones().size() > 0;
+	size_t start = 0, end = vertices.size();
+	while (start < end && vertices[start] == (weighted ? 0 : setupVertices[start])) start++;
+	while (end > start && vertices[end - 1] == (weighted ? 0 : setupVertices[end - 1])) end--;
+
+	Vector<float> &offsets = _offsets[frame];
+	offsets.setSize(end - start, 0);
+	for (size_t i = start; i < end; i++)
+		offsets[i - start] = weighted ? vertices[i] : vertices[i] - setupVertices[i];
+	offsets.shrinkToFit();
+	_offsetStarts[frame] = start;
+}
+
+void DeformTimeline::setFrame(int frame, float time, size_t start, Vector<float> &offsets) {
+	_frames[frame] = time;
+	_offsets[frame].clear();
+	_offsets[frame].addAll(offsets);
+	_offsetStarts[frame] = offsets.size() > 0 ? start : 0;
+}
+
+void DeformTimeline::getVertices(int frame, Vector<float> &vertices) {
+	Vector<float> &setupVertices = _attachment->getVertices();
+	bool weighted = _attachment->getBones().size() > 0;
+	size_t vertexCount = weighted ? setupVertices.size() / 3 * 2 : setupVertices.size();
+	vertices.setSize(vertexCount, 0);
+	Vector<float> &offsets = _offsets[frame];
+	size_t start = _offsetStarts[frame];
+	for (size_t i = 0; i < vertexCount; i++)
+		vertices[i] = (weighted ? 0 : setupVertices[i]) + getOffset(offsets, start, i);
+}
+
+Vector<Vector<float>> &DeformTimeline::getOffsets() {
+	return _offsets;
 }
 
-Vector<Vector<float>> &DeformTimeline::getVertices() {
-	return _vertices;
+Vector<size_t> &DeformTimeline::getOffsetStarts() {
+	return _offsetStarts;
 }
 
 VertexAttachment *DeformTimeline::getAttachment() {
@@ -56,16 +56,23 @@ EventTimeline::~EventTimeline() {
 }
 
 void EventTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						  MixBlend blend, MixDirection direction) {
+						  MixBlend blend, MixDirection direction, int *searchCursor) {
+	SP_UNUSED(skeleton);
+	SP_UNUSED(alpha);
+	SP_UNUSED(blend);
+	SP_UNUSED(direction);
+
 	if (pEvents == NULL) return;
 
-	Vector<Event *> &events = *pEvents;
+	collectEvents(lastTime, time, *pEvents, searchCursor);
+}
 
+void EventTimeline::collectEvents(float lastTime, float time, Vector<Event *> &events, int *searchCursor) {
 	size_t frameCount = _frames.size();
 
 	if (lastTime > time) {
 		// Fire events after last time for looped animations.
-		apply(skeleton, lastTime, FLT_MAX, pEvents, alpha, blend, direction);
+		collectEvents(lastTime, FLT_MAX, events, searchCursor);
 		lastTime = -1.0f;
 	} else if (lastTime >= _frames[frameCount - 1]) {
 		// Last time is after last i.
@@ -78,7 +85,7 @@ void EventTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	if (lastTime < _frames[0]) {
 		i = 0;
 	} else {
-		i = Animation::search(_frames, lastTime) + 1;
+		i = Animation::search(_frames, lastTime, 1, searchCursor) + 1;
 		float frameTime = _frames[i];
 		while (i > 0) {
 			// Fire multiple events with the same i.
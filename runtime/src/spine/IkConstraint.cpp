@@ -41,14 +41,14 @@ RTTI_IMPL(IkConstraint, Updatable)
 
 void IkConstraint::apply(Bone &bone, float targetX, float targetY, bool compress, bool stretch, bool uniform, float alpha) {
 	Bone *p = bone.getParent();
-	float pa = p->_a, pb = p->_b, pc = p->_c, pd = p->_d;
-	float rotationIK = -bone._ashearX - bone._arotation;
+	float pa = p->_a(), pb = p->_b(), pc = p->_c(), pd = p->_d();
+	float rotationIK = -bone._ashearX() - bone._arotation();
 	float tx = 0, ty = 0;
 
 	switch (bone._data.getTransformMode()) {
 		case TransformMode_OnlyTranslation:
-			tx = (targetX - bone._worldX) * MathUtil::sign(bone.getSkeleton().getScaleX());
-			ty = (targetY - bone._worldY) * MathUtil::sign(bone.getSkeleton().getScaleY());
+			tx = (targetX - bone._worldX()) * MathUtil::sign(bone.getSkeleton().getScaleX());
+			ty = (targetY - bone._worldY()) * MathUtil::sign(bone.getSkeleton().getScaleY());
 			break;
 		case TransformMode_NoRotationOrReflection: {
 			float s = MathUtil::abs(pa * pd - pb * pc) / MathUtil::max(0.0001f, pa * pa + pc * pc);
@@ -59,29 +59,29 @@ void IkConstraint::apply(Bone &bone, float targetX, float targetY, bool compress
 			rotationIK += MathUtil::atan2(sc, sa) * MathUtil::Rad_Deg;
 		}
 		default:
-			float x = targetX - p->_worldX, y = targetY - p->_worldY;
+			float x = targetX - p->_worldX(), y = targetY - p->_worldY();
 			float d = pa * pd - pb * pc;
 			if (MathUtil::abs(d) <= 0.0001f) {
 				tx = 0;
 				ty = 0;
 			} else {
-				tx = (x * pd - y * pb) / d - bone._ax;
-				ty = (y * pa - x * pc) / d - bone._ay;
+				tx = (x * pd - y * pb) / d - bone._ax();
+				ty = (y * pa - x * pc) / d - bone._ay();
 			}
 	}
 	rotationIK += MathUtil::atan2(ty, tx) * MathUtil::Rad_Deg;
-	if (bone._ascaleX < 0) rotationIK += 180;
+	if (bone._ascaleX() < 0) rotationIK += 180;
 	if (rotationIK > 180) rotationIK -= 360;
 	else if (rotationIK < -180)
 		rotationIK += 360;
-	float sx = bone._ascaleX;
-	float sy = bone._ascaleY;
+	float sx = bone._ascaleX();
+	float sy = bone._ascaleY();
 	if (compress || stretch) {
 		switch (bone._data.getTransformMode()) {
 			case TransformMode_NoScale:
 			case TransformMode_NoScaleOrReflection:
-				tx = targetX - bone._worldX;
-				ty = targetY - bone._worldY;
+				tx = targetX - bone._worldX();
+				ty = targetY - bone._worldY();
 			default:;
 		}
 		float b = bone._data.getLength() * sx, dd = MathUtil::sqrt(tx * tx + ty * ty);
@@ -91,8 +91,8 @@ void IkConstraint::apply(Bone &bone, float targetX, float targetY, bool compress
 			if (uniform) sy *= s;
 		}
 	}
-	bone.updateWorldTransform(bone._ax, bone._ay, bone._arotation + rotationIK * alpha, sx, sy, bone._ashearX,
-							  bone._ashearY);
+	bone.updateWorldTransform(bone._ax(), bone._ay(), bone._arotation() + rotationIK * alpha, sx, sy, bone._ashearX(),
+							  bone._ashearY());
 }
 
 void IkConstraint::apply(Bone &parent, Bone &child, float targetX, float targetY, int bendDir, bool stretch, bool uniform,
@@ -105,13 +105,13 @@ void IkConstraint::apply(Bone &parent, Bone &child, float targetX, float targetY
 	Bone *pp = parent.getParent();
 	float tx, ty, dx, dy, dd, l1, l2, a1, a2, r, td, sd, p;
 	float id, x, y;
-	px = parent._ax;
-	py = parent._ay;
-	psx = parent._ascaleX;
-	psy = parent._ascaleY;
+	px = parent._ax();
+	py = parent._ay();
+	psx = parent._ascaleX();
+	psy = parent._ascaleY();
 	sx = psx;
 	sy = psy;
-	csx = child._ascaleX;
+	csx = child._ascaleX();
 	if (psx < 0) {
 		psx = -psx;
 		o1 = 180;
@@ -130,36 +130,36 @@ void IkConstraint::apply(Bone &parent, Bone &child, float targetX, float targetY
 	} else
 		o2 = 0;
 	r = psx - psy;
-	cx = child._ax;
+	cx = child._ax();
 	u = (r < 0 ? -r : r) <= 0.0001f;
 	if (!u || stretch) {
 		cy = 0;
-		cwx = parent._a * cx + parent._worldX;
-		cwy = parent._c * cx + parent._worldY;
+		cwx = parent._a() * cx + parent._worldX();
+		cwy = parent._c() * cx + parent._worldY();
 	} else {
-		cy = child._ay;
-		cwx = parent._a * cx + parent._b * cy + parent._worldX;
-		cwy = parent._c * cx + parent._d * cy + parent._worldY;
+		cy = child._ay();
+		cwx = parent._a() * cx + parent._b() * cy + parent._worldX();
+		cwy = parent._c() * cx + parent._d() * cy + parent._worldY();
 	}
-	a = pp->_a;
-	b = pp->_b;
-	c = pp->_c;
-	d = pp->_d;
+	a = pp->_a();
+	b = pp->_b();
+	c = pp->_c();
+	d = pp->_d();
 	id = a * d - b * c;
 	id = MathUtil::abs(id) <= 0.0001f ? 0 : 1 / id;
-	x = cwx - pp->_worldX;
-	y = cwy - pp->_worldY;
+	x = cwx - pp->_worldX();
+	y = cwy - pp->_worldY();
 	dx = (x * d - y * b) * id - px;
 	dy = (y * a - x * c) * id - py;
 	l1 = MathUtil::sqrt(dx * dx + dy * dy);
 	l2 = child._data.getLength() * csx;
 	if (l1 < 0.0001) {
 		apply(parent, targetX, targetY, false, stretch, false, alpha);
-		child.updateWorldTransform(cx, cy, 0, child._ascaleX, child._ascaleY, child._ashearX, child._ashearY);
+		child.updateWorldTransform(cx, cy, 0, child._ascaleX(), child._ascaleY(), child._ashearX(), child._ashearY());
 		return;
 	}
-	x = targetX - pp->_worldX;
-	y = targetY - pp->_worldY;
+	x = targetX - pp->_worldX();
+	y = targetY - pp->_worldY();
 	tx = (x * d - y * b) * id - px;
 	ty = (y * a - x * c) * id - py;
 	dd = tx * tx + ty * ty;
@@ -248,17 +248,17 @@ void IkConstraint::apply(Bone &parent, Bone &child, float targetX, float targetY
 	}
 break_outer : {
 	float os = MathUtil::atan2(cy, cx) * s2;
-	a1 = (a1 - os) * MathUtil::Rad_Deg + o1 - parent._arotation;
+	a1 = (a1 - os) * MathUtil::Rad_Deg + o1 - parent._arotation();
 	if (a1 > 180) a1 -= 360;
 	else if (a1 < -180)
 		a1 += 360;
-	parent.updateWorldTransform(px, py, parent._arotation + a1 * alpha, sx, sy, 0, 0);
-	a2 = ((a2 + os) * MathUtil::Rad_Deg - child._ashearX) * s2 + o2 - child._arotation;
+	parent.updateWorldTransform(px, py, parent._arotation() + a1 * alpha, sx, sy, 0, 0);
+	a2 = ((a2 + os) * MathUtil::Rad_Deg - child._ashearX()) * s2 + o2 - child._arotation();
 	if (a2 > 180) a2 -= 360;
 	else if (a2 < -180)
 		a2 += 360;
-	child.updateWorldTransform(cx, cy, child._arotation + a2 * alpha, child._ascaleX, child._ascaleY,
-							   child._ashearX, child._ashearY);
+	child.updateWorldTransform(cx, cy, child._arotation() + a2 * alpha, child._ascaleX(), child._ascaleY(),
+							   child._ashearX(), child._ashearY());
 }
 }
 
@@ -269,13 +269,12 @@ IkConstraint::IkConstraint(IkConstraintData &data, Skeleton &skeleton) : Updatab
 																		 _stretch(data.getStretch()),
 																		 _mix(data.getMix()),
 																		 _softness(data.getSoftness()),
-																		 _target(skeleton.findBone(
-																				 data.getTarget()->getName())),
+																		 _target(skeleton.getBones()[data.getTarget()->getIndex()]),
 																		 _active(false) {
 	_bones.ensureCapacity(_data.getBones().size());
 	for (size_t i = 0; i < _data.getBones().size(); i++) {
 		BoneData *boneData = _data.getBones()[i];
-		_bones.add(skeleton.findBone(boneData->getName()));
+		_bones.add(skeleton.getBones()[boneData->getIndex()]);
 	}
 }
 
@@ -50,7 +50,7 @@ IkConstraintTimeline::IkConstraintTimeline(size_t frameCount, size_t bezierCount
 }
 
 void IkConstraintTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-								 MixBlend blend, MixDirection direction) {
+								 MixBlend blend, MixDirection direction, int *searchCursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 
@@ -80,7 +80,7 @@ void IkConstraintTimeline::apply(Skeleton &skeleton, float lastTime, float time,
 	}
 
 	float mix = 0, softness = 0;
-	int i = Animation::search(_frames, time, IkConstraintTimeline::ENTRIES);
+	int i = Animation::search(_frames, time, IkConstraintTimeline::ENTRIES, searchCursor);
 	int curveType = (int) _curves[i / IkConstraintTimeline::ENTRIES];
 	switch (curveType) {
 		case IkConstraintTimeline::LINEAR: {
@@ -28,6 +28,7 @@
  *****************************************************************************/
 
 #include <spine/MathUtil.h>
+#include <spine/Simd.h>
 #include <math.h>
 #include <stdlib.h>
 
@@ -60,38 +61,283 @@ float MathUtil::fmod(float a, float b) {
 	return (float) ::fmod(a, b);
 }
 
-/// Returns atan2 in radians, faster but less accurate than Math.Atan2. Average error of 0.00231 radians (0.1323
-/// degrees), largest error of 0.00488 radians (0.2796 degrees).
+float MathUtil::sqrt(float v) {
+	return (float) ::sqrt(v);
+}
+
+float MathUtil::acos(float v) {
+	return (float) ::acos(v);
+}
+
+static TrigMode trigMode = SPINE_DEFAULT_TRIG_MODE;
+
+// Minimax polynomials for sin and cos on [-pi/4, pi/4] (from Cephes sinf/cosf).
+static const float SinP0 = -1.6666654611e-1f, SinP1 = 8.3321608736e-3f, SinP2 = -1.9515295891e-4f;
+static const float CosP0 = 4.166664568298827e-2f, CosP1 = -1.388731625493765e-3f, CosP2 = 2.443315711809948e-5f;
+
+// Split pi / 2 so the range reduction in radians stays exact for moderate angles.
+static const float Pi_2_Hi = 1.5707963705062866f, Pi_2_Lo = -4.37113900018624283e-8f;
+
+static const int SinTableBits = 14;
+static const int SinTableCount = 1 << SinTableBits;
+static const int SinTableMask = SinTableCount - 1;
+static const float SinTableDegToIndex = SinTableCount / 360.0f;
+
+namespace {
+	struct SinTable {
+		float values[SinTableCount];
+
+		SinTable() {
+			for (int i = 0; i < SinTableCount; i++)
+				values[i] = (float) ::sin((i + 0.0) / SinTableCount * 2 * 3.1415926535897932385);
+		}
+	};
+}
+
+static const float *sinTable() {
+	// A function local static is initialized once even when first used by several threads.
+	static SinTable table;
+	return table.values;
+}
+
+// Angles from this many degrees or radians on are reduced to within a turn before they are converted to int, so the
+// conversions stay in range and the scalar and vector paths agree.
+static const float LargeDegrees = 1048576.0f, LargeRadians = 65536.0f;
+
+// Reduces a large angle with fmod, which is exact for degrees. Returns false for infinity and NaN, leaving the angle NaN
+// so the result is NaN like libm's.
+static bool reduceLarge(float &angle, float large, double turn) {
+	if (MathUtil::abs(angle) < large) return true;
+	angle = (float) ::fmod(angle, turn);
+	return angle == angle;
+}
+
+// Rounds to the nearest integer, ties to even, like the vector conversions below. Adding 1.5 * 2^23 leaves no bits for
+// the fraction, so the FPU does the rounding. The value must be within 2^22.
+static int roundToInt(float value) {
+	return (int) ((value + 12582912.0f) - 12582912.0f);
+}
+
+// Sine and cosine of r in [-pi/4, pi/4], rotated by quadrant * 90 degrees.
+static void polySinCos(float r, int quadrant, float &outSine, float &outCosine) {
+	float r2 = r * r;
+	float s = r + r * r2 * (SinP0 + r2 * (SinP1 + r2 * SinP2));
+	float c = 1 - r2 * 0.5f + r2 * r2 * (CosP0 + r2 * (CosP1 + r2 * CosP2));
+	if (quadrant & 1) {
+		float swap = s;
+		s = c;
+		c = swap;
+	}
+	outSine = quadrant & 2 ? -s : s;
+	outCosine = (quadrant + 1) & 2 ? -c : c;
+}
+
+static void polySinCosDeg(float degrees, float &outSine, float &outCosine) {
+	if (!reduceLarge(degrees, LargeDegrees, 360)) {
+		outSine = outCosine = degrees;
+		return;
+	}
+	// Multiples of 90 degrees are exact in float.
+	int quadrant = roundToInt(degrees * (1 / 90.0f));
+	polySinCos((degrees - (float) quadrant * 90) * MathUtil::Deg_Rad, quadrant, outSine, outCosine);
+}
+
+static void polySinCosRad(float radians, float &outSine, float &outCosine) {
+	if (!reduceLarge(radians, LargeRadians, 2 * 3.1415926535897932385)) {
+		outSine = outCosine = radians;
+		return;
+	}
+	int quadrant = roundToInt(radians * (2 / MathUtil::Pi));
+	polySinCos(radians - (float) quadrant * Pi_2_Hi - (float) quadrant * Pi_2_Lo, quadrant, outSine, outCosine);
+}
+
+static float tableSinDeg(float degrees) {
+	if (!reduceLarge(degrees, LargeDegrees, 360)) return degrees;
+	float index = degrees * SinTableDegToIndex + 0.5f;
+	int i = (int) index;
+	if (index < i) i--;
+	return sinTable()[i & SinTableMask];
+}
+
+// atan for |x| <= 1 (Abramowitz and Stegun 4.4.49), within 2e-8.
+static float polyAtan(float x) {
+	float x2 = x * x;
+	return x * (1 + x2 * (-0.3333314528f + x2 * (0.1999355085f + x2 * (-0.1420889944f + x2 * (0.1065626393f +
+		   x2 * (-0.0752896400f + x2 * (0.0429096138f + x2 * (-0.0161657367f + x2 * 0.0028662257f))))))));
+}
+
+static float polyAtan2(float y, float x) {
+	if (x == 0) {
+		if (y > 0) return MathUtil::Pi / 2;
+		if (y < 0) return -MathUtil::Pi / 2;
+		return 0;
+	}
+	float ax = MathUtil::abs(x), ay = MathUtil::abs(y);
+	float angle = ay <= ax ? polyAtan(ay / ax) : MathUtil::Pi / 2 - polyAtan(ax / ay);
+	if (x < 0) angle = MathUtil::Pi - angle;
+	return y < 0 ? -angle : angle;
+}
+
+void MathUtil::setTrigMode(TrigMode mode) {
+	if (mode == TrigMode_Table) sinTable();
+	trigMode = mode;
+}
+
+TrigMode MathUtil::getTrigMode() {
+	return trigMode;
+}
+
 float MathUtil::atan2(float y, float x) {
-	return (float) ::atan2(y, x);
+	if (trigMode == TrigMode_Exact) return (float) ::atan2(y, x);
+	return polyAtan2(y, x);
 }
 
-/// Returns the cosine in radians from a lookup table.
 float MathUtil::cos(float radians) {
-	return (float) ::cos(radians);
+	switch (trigMode) {
+		case TrigMode_Polynomial: {
+			float sine, cosine;
+			polySinCosRad(radians, sine, cosine);
+			return cosine;
+		}
+		case TrigMode_Table:
+			return tableSinDeg(radians * Rad_Deg + 90);
+		default:
+			return (float) ::cos(radians);
+	}
 }
 
-/// Returns the sine in radians from a lookup table.
 float MathUtil::sin(float radians) {
-	return (float) ::sin(radians);
+	switch (trigMode) {
+		case TrigMode_Polynomial: {
+			float sine, cosine;
+			polySinCosRad(radians, sine, cosine);
+			return sine;
+		}
+		case TrigMode_Table:
+			return tableSinDeg(radians * Rad_Deg);
+		default:
+			return (float) ::sin(radians);
+	}
 }
 
-float MathUtil::sqrt(float v) {
-	return (float) ::sqrt(v);
+float MathUtil::sinDeg(float degrees) {
+	switch (trigMode) {
+		case TrigMode_Polynomial: {
+			float sine, cosine;
+			polySinCosDeg(degrees, sine, cosine);
+			return sine;
+		}
+		case TrigMode_Table:
+			return tableSinDeg(degrees);
+		default:
+			return (float) ::sin(degrees * MathUtil::Deg_Rad);
+	}
 }
 
-float MathUtil::acos(float v) {
-	return (float) ::acos(v);
+float MathUtil::cosDeg(float degrees) {
+	switch (trigMode) {
+		case TrigMode_Polynomial: {
+			float sine, cosine;
+			polySinCosDeg(degrees, sine, cosine);
+			return cosine;
+		}
+		case TrigMode_Table:
+			return tableSinDeg(degrees + 90);
+		default:
+			return (float) ::cos(degrees * MathUtil::Deg_Rad);
+	}
 }
 
-/// Returns the sine in radians from a lookup table.
-float MathUtil::sinDeg(float degrees) {
-	return (float) ::sin(degrees * MathUtil::Deg_Rad);
+#if defined(SPINE_SIMD_SSE)
+static void polySinCosDeg4(const float *degrees, float *outSine, float *outCosine) {
+	__m128 angle = _mm_loadu_ps(degrees);
+	// Large, infinite and NaN angles are rare, the scalar path handles them.
+	if (_mm_movemask_ps(_mm_cmpnlt_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), angle), _mm_set1_ps(LargeDegrees)))) {
+		for (int i = 0; i < 4; i++)
+			polySinCosDeg(degrees[i], outSine[i], outCosine[i]);
+		return;
+	}
+	// Reduce to [-45, 45] degrees around the nearest multiple of 90.
+	__m128i quadrant = _mm_cvtps_epi32(_mm_mul_ps(angle, _mm_set1_ps(1 / 90.0f)));
+	__m128 r = _mm_sub_ps(angle, _mm_mul_ps(_mm_cvtepi32_ps(quadrant), _mm_set1_ps(90)));
+	r = _mm_mul_ps(r, _mm_set1_ps(MathUtil::Deg_Rad));
+	__m128 r2 = _mm_mul_ps(r, r);
+	__m128 s = _mm_add_ps(_mm_set1_ps(SinP1), _mm_mul_ps(r2, _mm_set1_ps(SinP2)));
+	s = _mm_add_ps(_mm_set1_ps(SinP0), _mm_mul_ps(r2, s));
+	s = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, r2), s));
+	__m128 c = _mm_add_ps(_mm_set1_ps(CosP1), _mm_mul_ps(r2, _mm_set1_ps(CosP2)));
+	c = _mm_add_ps(_mm_set1_ps(CosP0), _mm_mul_ps(r2, c));
+	c = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1), _mm_mul_ps(r2, _mm_set1_ps(0.5f))), _mm_mul_ps(_mm_mul_ps(r2, r2), c));
+	// Odd quadrants swap sine and cosine, quadrants 2 and 3 negate sine, 1 and 2 negate cosine.
+	__m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+	__m128 sineSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(2)), 30));
+	__m128 cosineSign = _mm_castsi128_ps(
+			_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+	_mm_storeu_ps(outSine, _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s)), sineSign));
+	_mm_storeu_ps(outCosine, _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c)), cosineSign));
+}
+#elif defined(SPINE_SIMD_NEON)
+static void polySinCosDeg4(const float *degrees, float *outSine, float *outCosine) {
+	float32x4_t angle = vld1q_f32(degrees);
+	// Large, infinite and NaN angles are rare, the scalar path handles them.
+	uint32x4_t small = vcaltq_f32(angle, vdupq_n_f32(LargeDegrees));
+	uint32x2_t allSmall = vand_u32(vget_low_u32(small), vget_high_u32(small));
+	if (!(vget_lane_u32(allSmall, 0) & vget_lane_u32(allSmall, 1))) {
+		for (int i = 0; i < 4; i++)
+			polySinCosDeg(degrees[i], outSine[i], outCosine[i]);
+		return;
+	}
+	// Reduce to [-45, 45] degrees around the nearest multiple of 90.
+	float32x4_t t = vmulq_f32(angle, vdupq_n_f32(1 / 90.0f));
+#if defined(__aarch64__)
+	int32x4_t quadrant = vcvtnq_s32_f32(t);
+#else
+	float32x4_t half = vbslq_f32(vcltq_f32(t, vdupq_n_f32(0)), vdupq_n_f32(-0.5f), vdupq_n_f32(0.5f));
+	int32x4_t quadrant = vcvtq_s32_f32(vaddq_f32(t, half));
+#endif
+	float32x4_t r = vsubq_f32(angle, vmulq_f32(vcvtq_f32_s32(quadrant), vdupq_n_f32(90)));
+	r = vmulq_f32(r, vdupq_n_f32(MathUtil::Deg_Rad));
+	float32x4_t r2 = vmulq_f32(r, r);
+	float32x4_t s = vaddq_f32(vdupq_n_f32(SinP1), vmulq_f32(r2, vdupq_n_f32(SinP2)));
+	s = vaddq_f32(vdupq_n_f32(SinP0), vmulq_f32(r2, s));
+	s = vaddq_f32(r, vmulq_f32(vmulq_f32(r, r2), s));
+	float32x4_t c = vaddq_f32(vdupq_n_f32(CosP1), vmulq_f32(r2, vdupq_n_f32(CosP2)));
+	c = vaddq_f32(vdupq_n_f32(CosP0), vmulq_f32(r2, c));
+	c = vaddq_f32(vsubq_f32(vdupq_n_f32(1), vmulq_f32(r2, vdupq_n_f32(0.5f))), vmulq_f32(vmulq_f32(r2, r2), c));
+	// Odd quadrants swap sine and cosine, quadrants 2 and 3 negate sine, 1 and 2 negate cosine.
+	uint32x4_t q = vreinterpretq_u32_s32(quadrant);
+	uint32x4_t swap = vceqq_u32(vandq_u32(q, vdupq_n_u32(1)), vdupq_n_u32(1));
+	uint32x4_t sineSign = vshlq_n_u32(vandq_u32(q, vdupq_n_u32(2)), 30);
+	uint32x4_t cosineSign = vshlq_n_u32(vandq_u32(vaddq_u32(q, vdupq_n_u32(1)), vdupq_n_u32(2)), 30);
+	vst1q_f32(outSine, vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vbslq_f32(swap, c, s)), sineSign)));
+	vst1q_f32(outCosine, vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vbslq_f32(swap, s, c)), cosineSign)));
 }
+#endif
 
-/// Returns the cosine in radians from a lookup table.
-float MathUtil::cosDeg(float degrees) {
-	return (float) ::cos(degrees * MathUtil::Deg_Rad);
+void MathUtil::sinCosDeg(const float *degrees, float *outSine, float *outCosine, size_t count) {
+	size_t i = 0;
+	switch (trigMode) {
+		case TrigMode_Polynomial:
+#if defined(SPINE_SIMD_SSE) || defined(SPINE_SIMD_NEON)
+			for (; i + 4 <= count; i += 4)
+				polySinCosDeg4(degrees + i, outSine + i, outCosine + i);
+#endif
+			for (; i < count; i++)
+				polySinCosDeg(degrees[i], outSine[i], outCosine[i]);
+			break;
+		case TrigMode_Table:
+			for (; i < count; i++) {
+				outSine[i] = tableSinDeg(degrees[i]);
+				outCosine[i] = tableSinDeg(degrees[i] + 90);
+			}
+			break;
+		default:
+			for (; i < count; i++) {
+				float radians = degrees[i] * MathUtil::Deg_Rad;
+				outSine[i] = (float) ::sin(radians);
+				outCosine[i] = (float) ::cos(radians);
+			}
+	}
 }
 
 /* Need to pass 0 as an argument, so VC++ doesn't error with C2124 */
@@ -53,7 +53,7 @@ PathConstraintSpacingTimeline::PathConstraintSpacingTimeline(size_t frameCount,
 }
 
 void PathConstraintSpacingTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents,
-										  float alpha, MixBlend blend, MixDirection direction) {
+										  float alpha, MixBlend blend, MixDirection direction, int *searchCursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -75,7 +75,7 @@ void PathConstraintSpacingTimeline::apply(Skeleton &skeleton, float lastTime, fl
 		}
 	}
 
-	float spacing = getCurveValue(time);
+	float spacing = getCurveValue(time, searchCursor);
 
 	if (blend == MixBlend_Setup)
 		constraint._spacing = constraint._data._spacing + (spacing - constraint._data._spacing) * alpha;
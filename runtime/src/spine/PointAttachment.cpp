@@ -47,8 +47,8 @@ void PointAttachment::computeWorldPosition(Bone &bone, float &ox, float &oy) {
 float PointAttachment::computeWorldRotation(Bone &bone) {
 	float cos = MathUtil::cosDeg(_rotation);
 	float sin = MathUtil::sinDeg(_rotation);
-	float ix = cos * bone._a + sin * bone._b;
-	float iy = cos * bone._c + sin * bone._d;
+	float ix = cos * bone._a() + sin * bone._b();
+	float iy = cos * bone._c() + sin * bone._d();
 
 	return MathUtil::atan2(iy, ix) * MathUtil::Rad_Deg;
 }
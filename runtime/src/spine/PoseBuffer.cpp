@@ -0,0 +1,293 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+#include <spine/PoseBuffer.h>
+
+#include <spine/Bone.h>
+#include <spine/IkConstraint.h>
+#include <spine/PathConstraint.h>
+#include <spine/Simd.h>
+#include <spine/Skeleton.h>
+#include <spine/Slot.h>
+#include <spine/SlotData.h>
+#include <spine/TransformConstraint.h>
+
+#include <assert.h>
+#include <string.h>
+
+using namespace spine;
+
+static const size_t BoneChannels = PoseChannel_AX - PoseChannel_X;
+static const size_t SlotChannels = 7;
+
+/// values += (to - values) * alpha
+static void lerp(float *values, const float *to, size_t count, float alpha) {
+	size_t i = 0;
+#if defined(SPINE_SIMD_SSE)
+	__m128 a = _mm_set1_ps(alpha);
+	for (; i + 4 <= count; i += 4) {
+		__m128 v = _mm_loadu_ps(values + i);
+		_mm_storeu_ps(values + i, _mm_add_ps(v, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(to + i), v), a)));
+	}
+#elif defined(SPINE_SIMD_NEON)
+	float32x4_t a = vdupq_n_f32(alpha);
+	for (; i + 4 <= count; i += 4) {
+		float32x4_t v = vld1q_f32(values + i);
+		vst1q_f32(values + i, vaddq_f32(v, vmulq_f32(vsubq_f32(vld1q_f32(to + i), v), a)));
+	}
+#endif
+	for (; i < count; i++)
+		values[i] += (to[i] - values[i]) * alpha;
+}
+
+/// Same as lerp() for rotations in degrees, taking the shortest route.
+static void lerpRotations(float *values, const float *to, size_t count, float alpha) {
+	size_t i = 0;
+#if defined(SPINE_SIMD_SSE)
+	__m128 a = _mm_set1_ps(alpha), turn = _mm_set1_ps(360), turns = _mm_set1_ps(1 / 360.0f);
+	for (; i + 4 <= count; i += 4) {
+		__m128 v = _mm_loadu_ps(values + i), diff = _mm_sub_ps(_mm_loadu_ps(to + i), v);
+		diff = _mm_sub_ps(diff, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtps_epi32(_mm_mul_ps(diff, turns))), turn));
+		_mm_storeu_ps(values + i, _mm_add_ps(v, _mm_mul_ps(diff, a)));
+	}
+#elif defined(SPINE_SIMD_NEON) && defined(__aarch64__)
+	float32x4_t a = vdupq_n_f32(alpha), turn = vdupq_n_f32(360), turns = vdupq_n_f32(1 / 360.0f);
+	for (; i + 4 <= count; i += 4) {
+		float32x4_t v = vld1q_f32(values + i), diff = vsubq_f32(vld1q_f32(to + i), v);
+		diff = vsubq_f32(diff, vmulq_f32(vcvtq_f32_s32(vcvtnq_s32_f32(vmulq_f32(diff, turns))), turn));
+		vst1q_f32(values + i, vaddq_f32(v, vmulq_f32(diff, a)));
+	}
+#endif
+	for (; i < count; i++) {
+		float diff = to[i] - values[i];
+		diff -= (16384 - (int) (16384.499999999996 - diff / 360)) * 360;
+		values[i] += diff * alpha;
+	}
+}
+
+PoseBuffer::PoseBuffer() : _boneCount(0), _boneStride(0), _slotCount(0), _slotStride(0) {
+}
+
+PoseBuffer::~PoseBuffer() {
+}
+
+void PoseBuffer::capture(Skeleton &skeleton) {
+	SkeletonPose &pose = skeleton.getPose();
+	_boneCount = pose.getBoneCount();
+	_boneStride = pose.getStride();
+	// The local channels come first in the pose, so they are copied in one block.
+	_boneValues.setSize(_boneStride * BoneChannels, 0);
+	if (_boneStride > 0)
+		memcpy(_boneValues.buffer(), pose.getChannel(PoseChannel_X), sizeof(float) * _boneStride * BoneChannels);
+
+	Vector<Slot *> &slots = skeleton.getSlots();
+	_slotCount = slots.size();
+	_slotStride = (_slotCount + 3) & ~(size_t) 3;
+	_slotColors.setSize(_slotStride * SlotChannels, 0);
+	_attachments.setSize(_slotCount, NULL);
+	_sequenceIndices.setSize(_slotCount, 0);
+	_deforms.setSize(_slotCount, Vector<float>());
+	float *colors = _slotColors.buffer();
+	size_t stride = _slotStride;
+	for (size_t i = 0; i < _slotCount; i++) {
+		Slot *slot = slots[i];
+		Color &color = slot->getColor(), &darkColor = slot->getDarkColor();
+		colors[i] = color.r;
+		colors[stride + i] = color.g;
+		colors[stride * 2 + i] = color.b;
+		colors[stride * 3 + i] = color.a;
+		colors[stride * 4 + i] = darkColor.r;
+		colors[stride * 5 + i] = darkColor.g;
+		colors[stride * 6 + i] = darkColor.b;
+		_attachments[i] = slot->getAttachment();
+		_sequenceIndices[i] = slot->getSequenceIndex();
+		_deforms[i].clearAndAddAll(slot->getDeform());
+	}
+
+	Vector<Slot *> &drawOrder = skeleton.getDrawOrder();
+	_drawOrder.setSize(drawOrder.size(), 0);
+	for (size_t i = 0, n = drawOrder.size(); i < n; i++)
+		_drawOrder[i] = drawOrder[i]->getData().getIndex();
+
+	_constraintValues.clear();
+	_ikValues.clear();
+	Vector<IkConstraint *> &ikConstraints = skeleton.getIkConstraints();
+	for (size_t i = 0, n = ikConstraints.size(); i < n; i++) {
+		IkConstraint *constraint = ikConstraints[i];
+		_constraintValues.add(constraint->getMix());
+		_constraintValues.add(constraint->getSoftness());
+		_ikValues.add(constraint->getBendDirection());
+		_ikValues.add(constraint->getCompress());
+		_ikValues.add(constraint->getStretch());
+	}
+	Vector<TransformConstraint *> &transformConstraints = skeleton.getTransformConstraints();
+	for (size_t i = 0, n = transformConstraints.size(); i < n; i++) {
+		TransformConstraint *constraint = transformConstraints[i];
+		_constraintValues.add(constraint->getMixRotate());
+		_constraintValues.add(constraint->getMixX());
+		_constraintValues.add(constraint->getMixY());
+		_constraintValues.add(constraint->getMixScaleX());
+		_constraintValues.add(constraint->getMixScaleY());
+		_constraintValues.add(constraint->getMixShearY());
+	}
+	Vector<PathConstraint *> &pathConstraints = skeleton.getPathConstraints();
+	for (size_t i = 0, n = pathConstraints.size(); i < n; i++) {
+		PathConstraint *constraint = pathConstraints[i];
+		_constraintValues.add(constraint->getPosition());
+		_constraintValues.add(constraint->getSpacing());
+		_constraintValues.add(constraint->getMixRotate());
+		_constraintValues.add(constraint->getMixX());
+		_constraintValues.add(constraint->getMixY());
+	}
+}
+
+void PoseBuffer::commit(Skeleton &skeleton) {
+	SkeletonPose &pose = skeleton.getPose();
+	assert(pose.getStride() == _boneStride && skeleton.getSlots().size() == _slotCount);
+	if (_boneStride > 0)
+		memcpy(pose.getChannel(PoseChannel_X), _boneValues.buffer(), sizeof(float) * _boneStride * BoneChannels);
+
+	Vector<Slot *> &slots = skeleton.getSlots();
+	float *colors = _slotColors.buffer();
+	size_t stride = _slotStride;
+	for (size_t i = 0; i < _slotCount; i++) {
+		Slot *slot = slots[i];
+		slot->getColor().set(colors[i], colors[stride + i], colors[stride * 2 + i], colors[stride * 3 + i]);
+		slot->getDarkColor().set(colors[stride * 4 + i], colors[stride * 5 + i], colors[stride * 6 + i]);
+		// Setting the attachment may clear the deform, so the deform is set after it.
+		slot->setAttachment(_attachments[i]);
+		slot->setSequenceIndex(_sequenceIndices[i]);
+		slot->getDeform().clearAndAddAll(_deforms[i]);
+	}
+
+	Vector<Slot *> &drawOrder = skeleton.getDrawOrder();
+	for (size_t i = 0, n = _drawOrder.size(); i < n; i++)
+		drawOrder[i] = slots[_drawOrder[i]];
+
+	float *values = _constraintValues.buffer();
+	int *ikValues = _ikValues.buffer();
+	Vector<IkConstraint *> &ikConstraints = skeleton.getIkConstraints();
+	for (size_t i = 0, n = ikConstraints.size(); i < n; i++, values += 2, ikValues += 3) {
+		IkConstraint *constraint = ikConstraints[i];
+		constraint->setMix(values[0]);
+		constraint->setSoftness(values[1]);
+		constraint->setBendDirection(ikValues[0]);
+		constraint->setCompress(ikValues[1] != 0);
+		constraint->setStretch(ikValues[2] != 0);
+	}
+	Vector<TransformConstraint *> &transformConstraints = skeleton.getTransformConstraints();
+	for (size_t i = 0, n = transformConstraints.size(); i < n; i++, values += 6) {
+		TransformConstraint *constraint = transformConstraints[i];
+		constraint->setMixRotate(values[0]);
+		constraint->setMixX(values[1]);
+		constraint->setMixY(values[2]);
+		constraint->setMixScaleX(values[3]);
+		constraint->setMixScaleY(values[4]);
+		constraint->setMixShearY(values[5]);
+	}
+	Vector<PathConstraint *> &pathConstraints = skeleton.getPathConstraints();
+	for (size_t i = 0, n = pathConstraints.size(); i < n; i++, values += 5) {
+		PathConstraint *constraint = pathConstraints[i];
+		constraint->setPosition(values[0]);
+		constraint->setSpacing(values[1]);
+		constraint->setMixRotate(values[2]);
+		constraint->setMixX(values[3]);
+		constraint->setMixY(values[4]);
+	}
+}
+
+void PoseBuffer::set(PoseBuffer &pose) {
+	_boneCount = pose._boneCount;
+	_boneStride = pose._boneStride;
+	_slotCount = pose._slotCount;
+	_slotStride = pose._slotStride;
+	_boneValues.clearAndAddAll(pose._boneValues);
+	_slotColors.clearAndAddAll(pose._slotColors);
+	_attachments.clearAndAddAll(pose._attachments);
+	_sequenceIndices.clearAndAddAll(pose._sequenceIndices);
+	_deforms.setSize(_slotCount, Vector<float>());
+	for (size_t i = 0; i < _slotCount; i++)
+		_deforms[i].clearAndAddAll(pose._deforms[i]);
+	_drawOrder.clearAndAddAll(pose._drawOrder);
+	_constraintValues.clearAndAddAll(pose._constraintValues);
+	_ikValues.clearAndAddAll(pose._ikValues);
+}
+
+void PoseBuffer::blend(PoseBuffer &to, float alpha) {
+	assert(to._boneStride == _boneStride && to._slotCount == _slotCount);
+	if (alpha <= 0) return;
+	if (alpha >= 1) {
+		set(to);
+		return;
+	}
+
+	float *values = _boneValues.buffer(), *toValues = to._boneValues.buffer();
+	size_t stride = _boneStride;
+	lerp(values, toValues, stride * PoseChannel_Rotation, alpha);
+	lerpRotations(values + stride * PoseChannel_Rotation, toValues + stride * PoseChannel_Rotation, stride, alpha);
+	lerp(values + stride * PoseChannel_ScaleX, toValues + stride * PoseChannel_ScaleX,
+		 stride * (BoneChannels - PoseChannel_ScaleX), alpha);
+	lerp(_slotColors.buffer(), to._slotColors.buffer(), _slotColors.size(), alpha);
+	lerp(_constraintValues.buffer(), to._constraintValues.buffer(), _constraintValues.size(), alpha);
+
+	for (size_t i = 0; i < _slotCount; i++) {
+		Vector<float> &deform = _deforms[i], &toDeform = to._deforms[i];
+		if (_attachments[i] == to._attachments[i] && deform.size() == toDeform.size())
+			lerp(deform.buffer(), toDeform.buffer(), deform.size(), alpha);
+		else
+			deform.clearAndAddAll(toDeform);
+	}
+	_attachments.clearAndAddAll(to._attachments);
+	_sequenceIndices.clearAndAddAll(to._sequenceIndices);
+	_drawOrder.clearAndAddAll(to._drawOrder);
+	_ikValues.clearAndAddAll(to._ikValues);
+}
+
+size_t PoseBuffer::getBoneCount() {
+	return _boneCount;
+}
+
+size_t PoseBuffer::getSlotCount() {
+	return _slotCount;
+}
+
+Vector<float> &PoseBuffer::getBoneValues() {
+	return _boneValues;
+}
+
+Vector<float> &PoseBuffer::getSlotColors() {
+	return _slotColors;
+}
+
+Vector<Attachment *> &PoseBuffer::getAttachments() {
+	return _attachments;
+}
+
+Vector<int> &PoseBuffer::getDrawOrder() {
+	return _drawOrder;
+}
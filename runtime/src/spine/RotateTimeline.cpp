@@ -49,7 +49,7 @@ RotateTimeline::RotateTimeline(size_t frameCount, size_t bezierCount, int boneIn
 }
 
 void RotateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						   MixBlend blend, MixDirection direction) {
+						   MixBlend blend, MixDirection direction, int *searchCursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -60,25 +60,25 @@ void RotateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_rotation = bone->_data._rotation;
+				bone->_rotation() = bone->_data._rotation;
 				return;
 			case MixBlend_First:
-				bone->_rotation += (bone->_data._rotation - bone->_rotation) * alpha;
+				bone->_rotation() += (bone->_data._rotation - bone->_rotation()) * alpha;
 			default: {
 			}
 		}
 		return;
 	}
 
-	float r = getCurveValue(time);
+	float r = getCurveValue(time, searchCursor);
 	switch (blend) {
 		case MixBlend_Setup:
-			bone->_rotation = bone->_data._rotation + r * alpha;
+			bone->_rotation() = bone->_data._rotation + r * alpha;
 			break;
 		case MixBlend_First:
 		case MixBlend_Replace:
-			r += bone->_data._rotation - bone->_rotation;
+			r += bone->_data._rotation - bone->_rotation();
 		case MixBlend_Add:
-			bone->_rotation += r * alpha;
+			bone->_rotation() += r * alpha;
 	}
 }
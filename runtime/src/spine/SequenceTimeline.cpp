@@ -62,7 +62,7 @@ void SequenceTimeline::setFrame(int frame, float time, SequenceMode mode, int in
 }
 
 void SequenceTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents,
-							 float alpha, MixBlend blend, MixDirection direction) {
+							 float alpha, MixBlend blend, MixDirection direction, int *searchCursor) {
 	SP_UNUSED(alpha);
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
@@ -81,7 +81,7 @@ void SequenceTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vec
 		return;
 	}
 
-	int i = Animation::search(frames, time, ENTRIES);
+	int i = Animation::search(frames, time, ENTRIES, searchCursor);
 	float before = frames[i];
 	int modeAndIndex = (int) frames[i + MODE];
 	float delay = frames[i + DELAY];
@@ -53,7 +53,7 @@ ShearTimeline::~ShearTimeline() {
 }
 
 void ShearTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						  MixBlend blend, MixDirection direction) {
+						  MixBlend blend, MixDirection direction, int *searchCursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -64,12 +64,12 @@ void ShearTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_shearX = bone->_data._shearX;
-				bone->_shearY = bone->_data._shearY;
+				bone->_shearX() = bone->_data._shearX;
+				bone->_shearY() = bone->_data._shearY;
 				return;
 			case MixBlend_First:
-				bone->_shearX += (bone->_data._shearX - bone->_shearX) * alpha;
-				bone->_shearY += (bone->_data._shearY - bone->_shearY) * alpha;
+				bone->_shearX() += (bone->_data._shearX - bone->_shearX()) * alpha;
+				bone->_shearY() += (bone->_data._shearY - bone->_shearY()) * alpha;
 			default: {
 			}
 		}
@@ -77,7 +77,7 @@ void ShearTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	}
 
 	float x, y;
-	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES);
+	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES, searchCursor);
 	int curveType = (int) _curves[i / CurveTimeline2::ENTRIES];
 	switch (curveType) {
 		case CurveTimeline2::LINEAR: {
@@ -103,17 +103,17 @@ void ShearTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 
 	switch (blend) {
 		case MixBlend_Setup:
-			bone->_shearX = bone->_data._shearX + x * alpha;
-			bone->_shearY = bone->_data._shearY + y * alpha;
+			bone->_shearX() = bone->_data._shearX + x * alpha;
+			bone->_shearY() = bone->_data._shearY + y * alpha;
 			break;
 		case MixBlend_First:
 		case MixBlend_Replace:
-			bone->_shearX += (bone->_data._shearX + x - bone->_shearX) * alpha;
-			bone->_shearY += (bone->_data._shearY + y - bone->_shearY) * alpha;
+			bone->_shearX() += (bone->_data._shearX + x - bone->_shearX()) * alpha;
+			bone->_shearY() += (bone->_data._shearY + y - bone->_shearY()) * alpha;
 			break;
 		case MixBlend_Add:
-			bone->_shearX += x * alpha;
-			bone->_shearY += y * alpha;
+			bone->_shearX() += x * alpha;
+			bone->_shearY() += y * alpha;
 	}
 }
 
@@ -130,7 +130,7 @@ ShearXTimeline::~ShearXTimeline() {
 }
 
 void ShearXTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						   MixBlend blend, MixDirection direction) {
+						   MixBlend blend, MixDirection direction, int *searchCursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -141,27 +141,27 @@ void ShearXTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_shearX = bone->_data._shearX;
+				bone->_shearX() = bone->_data._shearX;
 				return;
 			case MixBlend_First:
-				bone->_shearX += (bone->_data._shearX - bone->_shearX) * alpha;
+				bone->_shearX() += (bone->_data._shearX - bone->_shearX()) * alpha;
 			default: {
 			}
 		}
 		return;
 	}
 
-	float x = getCurveValue(time);
+	float x = getCurveValue(time, searchCursor);
 	switch (blend) {
 		case MixBlend_Setup:
-			bone->_shearX = bone->_data._shearX + x * alpha;
+			bone->_shearX() = bone->_data._shearX + x * alpha;
 			break;
 		case MixBlend_First:
 		case MixBlend_Replace:
-			bone->_shearX += (bone->_data._shearX + x - bone->_shearX) * alpha;
+			bone->_shearX() += (bone->_data._shearX + x - bone->_shearX()) * alpha;
 			break;
 		case MixBlend_Add:
-			bone->_shearX += x * alpha;
+			bone->_shearX() += x * alpha;
 	}
 }
 
@@ -178,7 +178,7 @@ ShearYTimeline::~ShearYTimeline() {
 }
 
 void ShearYTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-						   MixBlend blend, MixDirection direction) {
+						   MixBlend blend, MixDirection direction, int *searchCursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -189,26 +189,26 @@ void ShearYTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_shearY = bone->_data._shearY;
+				bone->_shearY() = bone->_data._shearY;
 				return;
 			case MixBlend_First:
-				bone->_shearY += (bone->_data._shearY - bone->_shearY) * alpha;
+				bone->_shearY() += (bone->_data._shearY - bone->_shearY()) * alpha;
 			default: {
 			}
 		}
 		return;
 	}
 
-	float y = getCurveValue(time);
+	float y = getCurveValue(time, searchCursor);
 	switch (blend) {
 		case MixBlend_Setup:
-			bone->_shearY = bone->_data._shearY + y * alpha;
+			bone->_shearY() = bone->_data._shearY + y * alpha;
 			break;
 		case MixBlend_First:
 		case MixBlend_Replace:
-			bone->_shearY += (bone->_data._shearY + y - bone->_shearY) * alpha;
+			bone->_shearY() += (bone->_data._shearY + y - bone->_shearY()) * alpha;
 			break;
 		case MixBlend_Add:
-			bone->_shearY += y * alpha;
+			bone->_shearY() += y * alpha;
 	}
 }
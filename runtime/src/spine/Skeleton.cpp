@@ -31,11 +31,14 @@
 
 #include <spine/Attachment.h>
 #include <spine/Bone.h>
+#include <spine/BoneKernel.h>
 #include <spine/IkConstraint.h>
 #include <spine/PathConstraint.h>
 #include <spine/SkeletonData.h>
+#include <spine/SkeletonUpdateOrder.h>
 #include <spine/Skin.h>
 #include <spine/Slot.h>
+#include <spine/TaskRunner.h>
 #include <spine/TransformConstraint.h>
 
 #include <spine/BoneData.h>
@@ -50,26 +53,42 @@
 #include <spine/ContainerUtil.h>
 
 #include <float.h>
+#include <string.h>
 
 using namespace spine;
 
 Skeleton::Skeleton(SkeletonData *skeletonData) : _data(skeletonData),
+												 _pose(skeletonData->getBones().size()),
+												 _updateOrderId(0),
+												 _programCacheSize(0),
+												 _programRunCount(0),
+												 _taskRunner(NULL),
+												 _parallelBranchSize(DefaultParallelBranchSize),
+												 _branchesValid(false),
+												 _incrementalUpdate(false),
+												 _lastLocalValid(false),
+												 _lastX(0),
+												 _lastY(0),
+												 _lastScaleX(0),
+												 _lastScaleY(0),
 												 _skin(NULL),
 												 _color(1, 1, 1, 1),
 												 _scaleX(1),
 												 _scaleY(1),
 												 _x(0),
 												 _y(0) {
+	allocateObjects();
+
 	_bones.ensureCapacity(_data->getBones().size());
 	for (size_t i = 0; i < _data->getBones().size(); ++i) {
 		BoneData *data = _data->getBones()[i];
 
 		Bone *bone;
 		if (data->getParent() == NULL) {
-			bone = new (__FILE__, __LINE__) Bone(*data, *this, NULL);
+			bone = new (nextObject(sizeof(Bone))) Bone(*data, *this, NULL, _pose, data->getIndex());
 		} else {
 			Bone *parent = _bones[data->getParent()->getIndex()];
-			bone = new (__FILE__, __LINE__) Bone(*data, *this, parent);
+			bone = new (nextObject(sizeof(Bone))) Bone(*data, *this, parent, _pose, data->getIndex());
 			parent->getChildren().add(bone);
 		}
 
@@ -82,7 +101,7 @@ Skeleton::Skeleton(SkeletonData *skeletonData) : _data(skeletonData),
 		SlotData *data = _data->getSlots()[i];
 
 		Bone *bone = _bones[data->getBoneData().getIndex()];
-		Slot *slot = new (__FILE__, __LINE__) Slot(*data, *bone);
+		Slot *slot = new (nextObject(sizeof(Slot))) Slot(*data, *bone);
 
 		_slots.add(slot);
 		_drawOrder.add(slot);
@@ -92,7 +111,7 @@ Skeleton::Skeleton(SkeletonData *skeletonData) : _data(skeletonData),
 	for (size_t i = 0; i < _data->getIkConstraints().size(); ++i) {
 		IkConstraintData *data = _data->getIkConstraints()[i];
 
-		IkConstraint *constraint = new (__FILE__, __LINE__) IkConstraint(*data, *this);
+		IkConstraint *constraint = new (nextObject(sizeof(IkConstraint))) IkConstraint(*data, *this);
 
 		_ikConstraints.add(constraint);
 	}
@@ -101,7 +120,8 @@ Skeleton::Skeleton(SkeletonData *skeletonData) : _data(skeletonData),
 	for (size_t i = 0; i < _data->getTransformConstraints().size(); ++i) {
 		TransformConstraintData *data = _data->getTransformConstraints()[i];
 
-		TransformConstraint *constraint = new (__FILE__, __LINE__) TransformConstraint(*data, *this);
+		TransformConstraint *constraint = new (nextObject(sizeof(TransformConstraint)))
+				TransformConstraint(*data, *this);
 
 		_transformConstraints.add(constraint);
 	}
@@ -110,7 +130,7 @@ Skeleton::Skeleton(SkeletonData *skeletonData) : _data(skeletonData),
 	for (size_t i = 0; i < _data->getPathConstraints().size(); ++i) {
 		PathConstraintData *data = _data->getPathConstraints()[i];
 
-		PathConstraint *constraint = new (__FILE__, __LINE__) PathConstraint(*data, *this);
+		PathConstraint *constraint = new (nextObject(sizeof(PathConstraint))) PathConstraint(*data, *this);
 
 		_pathConstraints.add(constraint);
 	}
@@ -118,15 +138,147 @@ Skeleton::Skeleton(SkeletonData *skeletonData) : _data(skeletonData),
 	updateCache();
 }
 
+Skeleton::Skeleton(Skeleton &prototype) : _data(prototype._data),
+										  _pose(prototype._bones.size()),
+										  _updateOrderId(0),
+										  _programCacheSize(0),
+										  _programRunCount(0),
+										  _taskRunner(prototype._taskRunner),
+										  _parallelBranchSize(prototype._parallelBranchSize),
+										  _branchesValid(false),
+										  _incrementalUpdate(prototype._incrementalUpdate),
+										  _lastLocalValid(false),
+										  _lastX(0),
+										  _lastY(0),
+										  _lastScaleX(0),
+										  _lastScaleY(0),
+										  _skin(prototype._skin),
+										  _color(prototype._color),
+										  _scaleX(prototype._scaleX),
+										  _scaleY(prototype._scaleY),
+										  _x(prototype._x),
+										  _y(prototype._y) {
+	_pose.set(prototype._pose);
+	allocateObjects();
+
+	_bones.ensureCapacity(prototype._bones.size());
+	for (size_t i = 0; i < prototype._bones.size(); ++i) {
+		Bone *prototypeBone = prototype._bones[i];
+
+		Bone *bone;
+		if (prototypeBone->_parent == NULL) {
+			bone = new (nextObject(sizeof(Bone))) Bone(*prototypeBone, *this, NULL);
+		} else {
+			Bone *parent = _bones[prototypeBone->_parent->_data.getIndex()];
+			bone = new (nextObject(sizeof(Bone))) Bone(*prototypeBone, *this, parent);
+			parent->getChildren().add(bone);
+		}
+
+		_bones.add(bone);
+	}
+
+	_slots.ensureCapacity(prototype._slots.size());
+	for (size_t i = 0; i < prototype._slots.size(); ++i) {
+		Slot *prototypeSlot = prototype._slots[i];
+		Bone *bone = _bones[prototypeSlot->_data.getBoneData().getIndex()];
+		_slots.add(new (nextObject(sizeof(Slot))) Slot(*prototypeSlot, *bone));
+	}
+
+	_drawOrder.ensureCapacity(prototype._drawOrder.size());
+	for (size_t i = 0; i < prototype._drawOrder.size(); ++i)
+		_drawOrder.add(_slots[prototype._drawOrder[i]->_data.getIndex()]);
+
+	_ikConstraints.ensureCapacity(prototype._ikConstraints.size());
+	for (size_t i = 0; i < prototype._ikConstraints.size(); ++i) {
+		IkConstraint &prototypeConstraint = *prototype._ikConstraints[i];
+		IkConstraint *constraint = new (nextObject(sizeof(IkConstraint)))
+				IkConstraint(prototypeConstraint._data, *this);
+		constraint->_bendDirection = prototypeConstraint._bendDirection;
+		constraint->_compress = prototypeConstraint._compress;
+		constraint->_stretch = prototypeConstraint._stretch;
+		constraint->_mix = prototypeConstraint._mix;
+		constraint->_softness = prototypeConstraint._softness;
+		_ikConstraints.add(constraint);
+	}
+
+	_transformConstraints.ensureCapacity(prototype._transformConstraints.size());
+	for (size_t i = 0; i < prototype._transformConstraints.size(); ++i) {
+		TransformConstraint &prototypeConstraint = *prototype._transformConstraints[i];
+		TransformConstraint *constraint = new (nextObject(sizeof(TransformConstraint)))
+				TransformConstraint(prototypeConstraint._data, *this);
+		constraint->_mixRotate = prototypeConstraint._mixRotate;
+		constraint->_mixX = prototypeConstraint._mixX;
+		constraint->_mixY = prototypeConstraint._mixY;
+		constraint->_mixScaleX = prototypeConstraint._mixScaleX;
+		constraint->_mixScaleY = prototypeConstraint._mixScaleY;
+		constraint->_mixShearY = prototypeConstraint._mixShearY;
+		_transformConstraints.add(constraint);
+	}
+
+	_pathConstraints.ensureCapacity(prototype._pathConstraints.size());
+	for (size_t i = 0; i < prototype._pathConstraints.size(); ++i) {
+		PathConstraint &prototypeConstraint = *prototype._pathConstraints[i];
+		PathConstraint *constraint = new (nextObject(sizeof(PathConstraint)))
+				PathConstraint(prototypeConstraint._data, *this);
+		constraint->_position = prototypeConstraint._position;
+		constraint->_spacing = prototypeConstraint._spacing;
+		constraint->_mixRotate = prototypeConstraint._mixRotate;
+		constraint->_mixX = prototypeConstraint._mixX;
+		constraint->_mixY = prototypeConstraint._mixY;
+		_pathConstraints.add(constraint);
+	}
+
+	// The update order of the prototype's skin is memoized on the skeleton data, so this only copies it.
+	updateCache();
+}
+
+Skeleton *Skeleton::clone() {
+	return new (__FILE__, __LINE__) Skeleton(*this);
+}
+
 Skeleton::~Skeleton() {
-	ContainerUtil::cleanUpVectorOfPointers(_bones);
-	ContainerUtil::cleanUpVectorOfPointers(_slots);
-	ContainerUtil::cleanUpVectorOfPointers(_ikConstraints);
-	ContainerUtil::cleanUpVectorOfPointers(_transformConstraints);
-	ContainerUtil::cleanUpVectorOfPointers(_pathConstraints);
+	destroyObjects(_bones);
+	destroyObjects(_slots);
+	destroyObjects(_ikConstraints);
+	destroyObjects(_transformConstraints);
+	destroyObjects(_pathConstraints);
+	if (_objects) SpineExtension::free(_objects, __FILE__, __LINE__);
+}
+
+static size_t objectSize(size_t size) {
+	return (size + 15) & ~(size_t) 15;
+}
+
+void Skeleton::allocateObjects() {
+	size_t size = objectSize(sizeof(Bone)) * _data->_bones.size() + objectSize(sizeof(Slot)) * _data->_slots.size() +
+				  objectSize(sizeof(IkConstraint)) * _data->_ikConstraints.size() +
+				  objectSize(sizeof(TransformConstraint)) * _data->_transformConstraints.size() +
+				  objectSize(sizeof(PathConstraint)) * _data->_pathConstraints.size();
+	_objects = size > 0 ? SpineExtension::alloc<char>(size, __FILE__, __LINE__) : NULL;
+	_objectsUsed = 0;
+}
+
+void *Skeleton::nextObject(size_t size) {
+	void *object = _objects + _objectsUsed;
+	_objectsUsed += objectSize(size);
+	return object;
+}
+
+template<typename T>
+void Skeleton::destroyObjects(Vector<T *> &objects) {
+	for (size_t i = objects.size(); i > 0; i--)
+		objects[i - 1]->~T();
+	objects.clear();
 }
 
 void Skeleton::updateCache() {
+	buildUpdateOrderKey();
+	size_t hash = SkeletonUpdateOrder::hashKey(_updateOrderKey);
+	if (_data->findUpdateOrder(*this, hash)) {
+		buildDirtyTracking();
+		return;
+	}
+
 	_updateCache.clear();
 
 	for (size_t i = 0, n = _bones.size(); i < n; ++i) {
@@ -153,41 +305,346 @@ void Skeleton::updateCache() {
 
 	size_t constraintCount = ikCount + transformCount + pathCount;
 
-	size_t i = 0;
-continue_outer:
-	for (; i < constraintCount; ++i) {
-		for (size_t ii = 0; ii < ikCount; ++ii) {
-			IkConstraint *constraint = _ikConstraints[ii];
-			if (constraint->getData().getOrder() == i) {
-				sortIkConstraint(constraint);
-				i++;
-				goto continue_outer;
-			}
+	// The constraint with each order, IK constraints first, then transform and path constraints if orders are repeated.
+	Vector<Updatable *> constraints;
+	constraints.setSize(constraintCount, NULL);
+	for (size_t i = 0; i < ikCount; ++i) {
+		size_t order = _ikConstraints[i]->getData().getOrder();
+		if (order < constraintCount && !constraints[order]) constraints[order] = _ikConstraints[i];
+	}
+	for (size_t i = 0; i < transformCount; ++i) {
+		size_t order = _transformConstraints[i]->getData().getOrder();
+		if (order < constraintCount && !constraints[order]) constraints[order] = _transformConstraints[i];
+	}
+	for (size_t i = 0; i < pathCount; ++i) {
+		size_t order = _pathConstraints[i]->getData().getOrder();
+		if (order < constraintCount && !constraints[order]) constraints[order] = _pathConstraints[i];
+	}
+
+	for (size_t i = 0; i < constraintCount; ++i) {
+		Updatable *constraint = constraints[i];
+		if (!constraint) continue;
+		if (constraint->getRTTI().isExactly(IkConstraint::rtti))
+			sortIkConstraint(static_cast<IkConstraint *>(constraint));
+		else if (constraint->getRTTI().isExactly(TransformConstraint::rtti))
+			sortTransformConstraint(static_cast<TransformConstraint *>(constraint));
+		else
+			sortPathConstraint(static_cast<PathConstraint *>(constraint));
+	}
+
+	for (size_t i = 0, n = _bones.size(); i < n; ++i) {
+		sortBone(_bones[i]);
+	}
+
+	compileUpdateProgram();
+	buildDirtyTracking();
+	_data->addUpdateOrder(*this, hash);
+}
+
+void Skeleton::buildUpdateOrderKey() {
+	Vector<const void *> &key = _updateOrderKey;
+	key.clear();
+	key.add((const void *) _bones.size());
+	key.add((const void *) (_ikConstraints.size() + _transformConstraints.size() + _pathConstraints.size()));
+	// Besides its content, the sort only depends on whether the skin is none, the default skin or another skin.
+	key.add((const void *) (size_t) (_skin == NULL ? 0 : _skin == _data->_defaultSkin ? 1 : 2));
+	if (_skin) {
+		Vector<BoneData *> &skinBones = _skin->getBones();
+		for (size_t i = 0, n = skinBones.size(); i < n; i++)
+			key.add(skinBones[i]);
+		key.add(NULL);
+		Vector<ConstraintData *> &skinConstraints = _skin->getConstraints();
+		for (size_t i = 0, n = skinConstraints.size(); i < n; i++)
+			key.add(skinConstraints[i]);
+	}
+	key.add(NULL);
+
+	// The path attachments of the same skins as in sortPathConstraint(), whose attachments can be changed at any time. The
+	// sort only uses the bones of a path attachment, so those are the key rather than the attachment, which may be deleted
+	// with its skin.
+	for (size_t i = 0, n = _pathConstraints.size(); i < n; i++) {
+		Slot *slot = _pathConstraints[i]->getTarget();
+		size_t slotIndex = slot->getData().getIndex();
+		addUpdateOrderKey(slot->getAttachment());
+		if (_skin) addUpdateOrderKey(_skin, slotIndex);
+		if (_data->_defaultSkin != NULL && _data->_defaultSkin != _skin) addUpdateOrderKey(_data->_defaultSkin, slotIndex);
+		for (size_t ii = 0, nn = _data->_skins.size(); ii < nn; ii++)
+			addUpdateOrderKey(_data->_skins[ii], slotIndex);
+		key.add(NULL);
+	}
+}
+
+void Skeleton::addUpdateOrderKey(Skin *skin, size_t slotIndex) {
+	Skin::AttachmentMap::Entries attachments = skin->getAttachments();
+	while (attachments.hasNext()) {
+		Skin::AttachmentMap::Entry entry = attachments.next();
+		if (entry._slotIndex == slotIndex) addUpdateOrderKey(entry._attachment);
+	}
+}
+
+void Skeleton::addUpdateOrderKey(Attachment *attachment) {
+	if (attachment == NULL || !attachment->getRTTI().instanceOf(PathAttachment::rtti)) return;
+	// The count is offset by one to not be taken for the NULL ending the attachments of a slot.
+	Vector<int> &pathBones = static_cast<PathAttachment *>(attachment)->getBones();
+	_updateOrderKey.add((const void *) (pathBones.size() + 1));
+	for (size_t i = 0, n = pathBones.size(); i < n; i++)
+		_updateOrderKey.add((const void *) (size_t) pathBones[i]);
+}
+
+SkeletonUpdateOrder *Skeleton::saveUpdateOrder(size_t hash) {
+	SkeletonUpdateOrder *order = new (__FILE__, __LINE__) SkeletonUpdateOrder(_updateOrderKey, hash,
+																					 _updateOrderId);
+	order->_updateCache.ensureCapacity(_updateCache.size());
+	for (size_t i = 0, n = _updateCache.size(); i < n; i++) {
+		Updatable *updatable = _updateCache[i];
+		UpdateInstruction instruction;
+		instruction.mode = TransformMode_Normal;
+		if (updatable->getRTTI().isExactly(Bone::rtti)) {
+			Bone *bone = static_cast<Bone *>(updatable);
+			instruction.op = UpdateOp_Bone;
+			instruction.mode = bone->_data.getTransformMode();
+			instruction.index = bone->_data.getIndex();
+		} else if (updatable->getRTTI().isExactly(IkConstraint::rtti)) {
+			instruction.op = UpdateOp_IkConstraint;
+			instruction.index = _ikConstraints.indexOf(static_cast<IkConstraint *>(updatable));
+		} else if (updatable->getRTTI().isExactly(TransformConstraint::rtti)) {
+			instruction.op = UpdateOp_TransformConstraint;
+			instruction.index = _transformConstraints.indexOf(static_cast<TransformConstraint *>(updatable));
+		} else {
+			instruction.op = UpdateOp_PathConstraint;
+			instruction.index = _pathConstraints.indexOf(static_cast<PathConstraint *>(updatable));
 		}
+		order->_updateCache.add(instruction);
+	}
 
-		for (size_t ii = 0; ii < transformCount; ++ii) {
-			TransformConstraint *constraint = _transformConstraints[ii];
-			if (constraint->getData().getOrder() == i) {
-				sortTransformConstraint(constraint);
-				i++;
-				goto continue_outer;
-			}
+	Vector<bool> &active = order->_active;
+	active.ensureCapacity(_bones.size() + _ikConstraints.size() + _transformConstraints.size() + _pathConstraints.size());
+	for (size_t i = 0, n = _bones.size(); i < n; i++)
+		active.add(_bones[i]->_active);
+	for (size_t i = 0, n = _ikConstraints.size(); i < n; i++)
+		active.add(_ikConstraints[i]->_active);
+	for (size_t i = 0, n = _transformConstraints.size(); i < n; i++)
+		active.add(_transformConstraints[i]->_active);
+	for (size_t i = 0, n = _pathConstraints.size(); i < n; i++)
+		active.add(_pathConstraints[i]->_active);
+
+	order->_updateProgram.clearAndAddAll(_updateProgram);
+	order->_normalRuns.clearAndAddAll(_normalRuns);
+	order->_runBones.clearAndAddAll(_runBones);
+	order->_runParents.clearAndAddAll(_runParents);
+	order->_runLevelEnds.clearAndAddAll(_runLevelEnds);
+	return order;
+}
+
+void Skeleton::loadUpdateOrder(SkeletonUpdateOrder &order) {
+	_updateOrderId = order._id;
+	_updateCache.clear();
+	_updateCache.ensureCapacity(order._updateCache.size());
+	for (size_t i = 0, n = order._updateCache.size(); i < n; i++) {
+		UpdateInstruction &instruction = order._updateCache[i];
+		switch (instruction.op) {
+			case UpdateOp_Bone:
+				_updateCache.add(_bones[instruction.index]);
+				break;
+			case UpdateOp_IkConstraint:
+				_updateCache.add(_ikConstraints[instruction.index]);
+				break;
+			case UpdateOp_TransformConstraint:
+				_updateCache.add(_transformConstraints[instruction.index]);
+				break;
+			default:
+				_updateCache.add(_pathConstraints[instruction.index]);
 		}
+	}
+
+	bool *active = order._active.buffer();
+	for (size_t i = 0, n = _bones.size(); i < n; i++)
+		_bones[i]->_active = *active++;
+	for (size_t i = 0, n = _ikConstraints.size(); i < n; i++)
+		_ikConstraints[i]->_active = *active++;
+	for (size_t i = 0, n = _transformConstraints.size(); i < n; i++)
+		_transformConstraints[i]->_active = *active++;
+	for (size_t i = 0, n = _pathConstraints.size(); i < n; i++)
+		_pathConstraints[i]->_active = *active++;
+
+	_updateProgram.clearAndAddAll(order._updateProgram);
+	_normalRuns.clearAndAddAll(order._normalRuns);
+	_runBones.clearAndAddAll(order._runBones);
+	_runParents.clearAndAddAll(order._runParents);
+	_runLevelEnds.clearAndAddAll(order._runLevelEnds);
+	_programCacheSize = _updateCache.size();
+	_programRunCount = _normalRuns.size();
+	_branchesValid = false;
+}
+
+void Skeleton::compileUpdateProgram() {
+	_updateProgram.clear();
+	_normalRuns.clear();
+	_runBones.clear();
+	_runParents.clear();
+	_runLevelEnds.clear();
+	_programCacheSize = _updateCache.size();
+	_branchesValid = false;
+	appendUpdateProgram(_updateCache.buffer(), _updateCache.size(), _updateProgram);
+	_programRunCount = _normalRuns.size();
+}
 
-		for (size_t ii = 0; ii < pathCount; ++ii) {
-			PathConstraint *constraint = _pathConstraints[ii];
-			if (constraint->getData().getOrder() == i) {
-				sortPathConstraint(constraint);
-				i++;
-				goto continue_outer;
+void Skeleton::appendUpdateProgram(Updatable **entries, size_t count, Vector<UpdateInstruction> &program) {
+	// Level of each bone in the current run, -1 if the bone is not part of it.
+	Vector<int> levels;
+	levels.setSize(_bones.size(), -1);
+
+	for (size_t i = 0; i < count;) {
+		size_t start = i;
+		int maxLevel = -1;
+		for (; i < count; i++) {
+			Updatable *updatable = entries[i];
+			if (!updatable->getRTTI().isExactly(Bone::rtti)) break;
+			Bone *bone = static_cast<Bone *>(updatable);
+			if (bone->_parent == NULL || bone->_data.getTransformMode() != TransformMode_Normal) break;
+			// A bone updated twice ends the run, its second update must see what happened in between.
+			if (levels[bone->_data.getIndex()] != -1) break;
+			int level = levels[bone->_parent->_data.getIndex()] + 1;
+			levels[bone->_data.getIndex()] = level;
+			if (level > maxLevel) maxLevel = level;
+		}
+		if (i - start > 1) {
+			addNormalRun(entries + start, i - start, maxLevel, levels, program);
+			continue;
+		}
+		if (i == start) i++;
+		for (size_t ii = start; ii < i; ii++) {
+			Updatable *updatable = entries[ii];
+			UpdateInstruction instruction;
+			instruction.mode = TransformMode_Normal;
+			if (updatable->getRTTI().isExactly(Bone::rtti)) {
+				Bone *bone = static_cast<Bone *>(updatable);
+				levels[bone->_data.getIndex()] = -1;
+				instruction.op = UpdateOp_Bone;
+				instruction.mode = bone->_data.getTransformMode();
+				instruction.index = bone->_data.getIndex();
+			} else if (updatable->getRTTI().isExactly(IkConstraint::rtti)) {
+				instruction.op = UpdateOp_IkConstraint;
+				instruction.index = _ikConstraints.indexOf(static_cast<IkConstraint *>(updatable));
+			} else if (updatable->getRTTI().isExactly(TransformConstraint::rtti)) {
+				instruction.op = UpdateOp_TransformConstraint;
+				instruction.index = _transformConstraints.indexOf(static_cast<TransformConstraint *>(updatable));
+			} else if (updatable->getRTTI().isExactly(PathConstraint::rtti)) {
+				instruction.op = UpdateOp_PathConstraint;
+				instruction.index = _pathConstraints.indexOf(static_cast<PathConstraint *>(updatable));
+			} else {
+				instruction.op = UpdateOp_Updatable;
+				instruction.index = (int) ii;
 			}
+			program.add(instruction);
 		}
 	}
+}
 
-	size_t n = _bones.size();
-	for (i = 0; i < n; ++i) {
-		sortBone(_bones[i]);
+void Skeleton::addNormalRun(Updatable **entries, size_t count, int maxLevel, Vector<int> &levels,
+							Vector<UpdateInstruction> &program) {
+	// Counting sort of the run's bones by level, keeping the update cache order within a level.
+	Vector<size_t> levelStarts;
+	levelStarts.setSize(maxLevel + 1, 0);
+	for (size_t i = 0; i < count; i++)
+		levelStarts[levels[static_cast<Bone *>(entries[i])->_data.getIndex()]]++;
+	size_t offset = 0;
+	for (int level = 0; level <= maxLevel; level++) {
+		size_t levelSize = levelStarts[level];
+		levelStarts[level] = offset;
+		offset += levelSize;
+	}
+	size_t firstBone = _runBones.size();
+	_runBones.setSize(firstBone + offset, 0);
+	_runParents.setSize(firstBone + offset, 0);
+	for (size_t i = 0; i < count; i++) {
+		Bone *bone = static_cast<Bone *>(entries[i]);
+		size_t index = firstBone + levelStarts[levels[bone->_data.getIndex()]]++;
+		_runBones[index] = bone->_data.getIndex();
+		_runParents[index] = bone->_parent->_data.getIndex();
 	}
+
+	NormalBoneRun run;
+	run.firstBone = firstBone;
+	run.firstLevel = _runLevelEnds.size();
+	for (int level = 0; level <= maxLevel; level++)
+		_runLevelEnds.add(levelStarts[level]);
+	run.lastLevel = _runLevelEnds.size();
+
+	UpdateInstruction instruction;
+	instruction.op = UpdateOp_NormalRun;
+	instruction.mode = TransformMode_Normal;
+	instruction.index = (int) _normalRuns.size();
+	program.add(instruction);
+	_normalRuns.add(run);
+
+	for (size_t i = 0; i < count; i++)
+		levels[static_cast<Bone *>(entries[i])->_data.getIndex()] = -1;
+}
+
+void Skeleton::buildDirtyTracking() {
+	_lastLocalValid = false;
+
+	_constrainedBones.clear();
+	_constrainedBones.setSize(_bones.size(), false);
+	_dirtyBones.setSize(_bones.size(), false);
+	for (size_t i = 0, n = _updateProgram.size(); i < n; i++) {
+		UpdateInstruction &instruction = _updateProgram[i];
+		Vector<Bone *> *constrained;
+		switch (instruction.op) {
+			case UpdateOp_IkConstraint:
+				constrained = &_ikConstraints[instruction.index]->getBones();
+				break;
+			case UpdateOp_TransformConstraint:
+				constrained = &_transformConstraints[instruction.index]->getBones();
+				break;
+			case UpdateOp_PathConstraint:
+				constrained = &_pathConstraints[instruction.index]->getBones();
+				break;
+			case UpdateOp_Updatable:
+				// Any bone may be changed by an unknown updatable, so all are always updated.
+				for (size_t ii = 0, nn = _bones.size(); ii < nn; ii++)
+					_constrainedBones[ii] = true;
+				return;
+			default:
+				continue;
+		}
+		for (size_t ii = 0, nn = constrained->size(); ii < nn; ii++)
+			_constrainedBones[(*constrained)[ii]->_data.getIndex()] = true;
+	}
+
+	// Parents come before their children, so one pass marks the descendants of constrained bones.
+	for (size_t i = 0, n = _bones.size(); i < n; i++) {
+		Bone *parent = _bones[i]->_parent;
+		if (parent && _constrainedBones[parent->_data.getIndex()]) _constrainedBones[i] = true;
+	}
+}
+
+void Skeleton::markChangedBones() {
+	size_t stride = _pose.getStride();
+	size_t boneCount = _bones.size();
+	const float *local = _pose.getChannel(PoseChannel_X);
+	const float *last = _lastLocal.buffer();
+	bool *dirty = _dirtyBones.buffer();
+	const bool *constrained = _constrainedBones.buffer();
+	for (size_t i = 0; i < boneCount; i++)
+		dirty[i] = constrained[i];
+	for (int channel = PoseChannel_X; channel < PoseChannel_AX; channel++) {
+		const float *values = local + channel * stride, *lastValues = last + channel * stride;
+		for (size_t i = 0; i < boneCount; i++)
+			dirty[i] |= values[i] != lastValues[i];
+	}
+}
+
+void Skeleton::saveLocalPose() {
+	size_t size = _pose.getStride() * (PoseChannel_AX - PoseChannel_X);
+	if (_lastLocal.size() != size) _lastLocal.setSize(size, 0);
+	if (size > 0) memcpy(_lastLocal.buffer(), _pose.getChannel(PoseChannel_X), sizeof(float) * size);
+	_lastX = _x;
+	_lastY = _y;
+	_lastScaleX = getScaleX();
+	_lastScaleY = getScaleY();
+	_lastLocalValid = true;
 }
 
 void Skeleton::printUpdateCache() {
@@ -205,46 +662,315 @@ void Skeleton::printUpdateCache() {
 	}
 }
 
-void Skeleton::updateWorldTransform() {
-	for (size_t i = 0, n = _bones.size(); i < n; i++) {
-		Bone *bone = _bones[i];
-		bone->_ax = bone->_x;
-		bone->_ay = bone->_y;
-		bone->_arotation = bone->_rotation;
-		bone->_ascaleX = bone->_scaleX;
-		bone->_ascaleY = bone->_scaleY;
-		bone->_ashearX = bone->_shearX;
-		bone->_ashearY = bone->_shearY;
+void Skeleton::printUpdateProgram() {
+	static const char *modes[] = {"normal", "onlyTranslation", "noRotationOrReflection", "noScale", "noScaleOrReflection"};
+	for (size_t i = 0; i < _updateProgram.size(); i++) {
+		UpdateInstruction &instruction = _updateProgram[i];
+		switch (instruction.op) {
+			case UpdateOp_Bone:
+				printf("bone %s (%s)\n", _bones[instruction.index]->getData().getName().buffer(), modes[instruction.mode]);
+				break;
+			case UpdateOp_NormalRun: {
+				NormalBoneRun &run = _normalRuns[instruction.index];
+				printf("normal run %d:", instruction.index);
+				for (size_t level = run.firstLevel, start = 0; level < run.lastLevel; level++) {
+					printf(" [");
+					for (size_t end = _runLevelEnds[level]; start < end; start++)
+						printf(" %s", _bones[_runBones[run.firstBone + start]]->getData().getName().buffer());
+					printf(" ]");
+				}
+				printf("\n");
+				break;
+			}
+			case UpdateOp_IkConstraint:
+				printf("ik constraint %s\n", _ikConstraints[instruction.index]->getData().getName().buffer());
+				break;
+			case UpdateOp_TransformConstraint:
+				printf("transform constraint %s\n", _transformConstraints[instruction.index]->getData().getName().buffer());
+				break;
+			case UpdateOp_PathConstraint:
+				printf("path constraint %s\n", _pathConstraints[instruction.index]->getData().getName().buffer());
+				break;
+			case UpdateOp_Updatable:
+				printf("updatable %d\n", instruction.index);
+				break;
+		}
 	}
+}
 
-	for (size_t i = 0, n = _updateCache.size(); i < n; ++i) {
-		_updateCache[i]->update();
+void Skeleton::updateWorldTransform() {
+	_pose.resetAppliedTransforms();
+
+	if (!_incrementalUpdate) {
+		if (_taskRunner && _updateCache.size() == _programCacheSize) {
+			if (!_branchesValid) compileBranches();
+			if (_branchStarts.size() > 0) {
+				runBranches();
+				return;
+			}
+		}
+		runUpdateProgram(-1, false);
+		return;
 	}
+
+	bool incremental = _lastLocalValid && _lastX == _x && _lastY == _y && _lastScaleX == getScaleX() &&
+					   _lastScaleY == getScaleY();
+	if (incremental) markChangedBones();
+	runUpdateProgram(-1, incremental);
+	saveLocalPose();
 }
 
 void Skeleton::updateWorldTransform(Bone *parent) {
 	// Apply the parent bone transform to the root bone. The root bone always inherits scale, rotation and reflection.
 	Bone &rootBone = *getRootBone();
-	float pa = parent->_a, pb = parent->_b, pc = parent->_c, pd = parent->_d;
-	rootBone._worldX = pa * _x + pb * _y + parent->_worldX;
-	rootBone._worldY = pc * _x + pd * _y + parent->_worldY;
-
-	float rotationY = rootBone._rotation + 90 + rootBone._shearY;
-	float la = MathUtil::cosDeg(rootBone._rotation + rootBone._shearX) * rootBone._scaleX;
-	float lb = MathUtil::cosDeg(rotationY) * rootBone._scaleY;
-	float lc = MathUtil::sinDeg(rootBone._rotation + rootBone._shearX) * rootBone._scaleX;
-	float ld = MathUtil::sinDeg(rotationY) * rootBone._scaleY;
-	rootBone._a = (pa * la + pb * lc) * _scaleX;
-	rootBone._b = (pa * lb + pb * ld) * _scaleX;
-	rootBone._c = (pc * la + pd * lc) * _scaleY;
-	rootBone._d = (pc * lb + pd * ld) * _scaleY;
+	float pa = parent->_a(), pb = parent->_b(), pc = parent->_c(), pd = parent->_d();
+	rootBone._worldX() = pa * _x + pb * _y + parent->_worldX();
+	rootBone._worldY() = pc * _x + pd * _y + parent->_worldY();
+
+	float rotationY = rootBone._rotation() + 90 + rootBone._shearY();
+	float la = MathUtil::cosDeg(rootBone._rotation() + rootBone._shearX()) * rootBone._scaleX();
+	float lb = MathUtil::cosDeg(rotationY) * rootBone._scaleY();
+	float lc = MathUtil::sinDeg(rootBone._rotation() + rootBone._shearX()) * rootBone._scaleX();
+	float ld = MathUtil::sinDeg(rotationY) * rootBone._scaleY();
+	rootBone._a() = (pa * la + pb * lc) * _scaleX;
+	rootBone._b() = (pa * lb + pb * ld) * _scaleX;
+	rootBone._c() = (pc * la + pd * lc) * _scaleY;
+	rootBone._d() = (pc * lb + pd * ld) * _scaleY;
 
 	// Update everything except root bone.
-	Bone *rb = getRootBone();
-	for (size_t i = 0, n = _updateCache.size(); i < n; i++) {
+	runUpdateProgram(getRootBone()->_data.getIndex(), false);
+	_lastLocalValid = false;
+}
+
+void Skeleton::setIncrementalUpdate(bool inValue) {
+	_incrementalUpdate = inValue;
+	_lastLocalValid = false;
+}
+
+bool Skeleton::isIncrementalUpdate() {
+	return _incrementalUpdate;
+}
+
+void Skeleton::runUpdateProgram(int skipBone, bool incremental) {
+	// The program and dirty tracking are only valid for the update cache they were compiled from.
+	if (_updateCache.size() != _programCacheSize) {
+		Updatable *skip = skipBone == -1 ? NULL : _bones[skipBone];
+		for (size_t i = 0, n = _updateCache.size(); i < n; i++) {
+			Updatable *updatable = _updateCache[i];
+			if (updatable != skip) updatable->update();
+		}
+		_lastLocalValid = false;
+		return;
+	}
+
+	runInstructions(_updateProgram.buffer(), _updateProgram.size(), skipBone, incremental);
+}
+
+void Skeleton::runInstructions(const UpdateInstruction *program, size_t count, int skipBone, bool incremental) {
+	Bone **bones = _bones.buffer();
+	bool *dirty = _dirtyBones.buffer();
+	for (size_t i = 0; i < count; i++) {
+		const UpdateInstruction &instruction = program[i];
+		switch (instruction.op) {
+			case UpdateOp_Bone: {
+				int index = instruction.index;
+				if (index == skipBone) break;
+				Bone *bone = bones[index];
+				if (incremental) {
+					Bone *parent = bone->_parent;
+					if (!dirty[index] && !(parent && dirty[parent->_data.getIndex()])) break;
+					dirty[index] = true;
+				}
+				bone->Bone::update();
+				break;
+			}
+			case UpdateOp_NormalRun: {
+				// Runs never contain the root bone, so skipBone needs no check here.
+				NormalBoneRun &run = _normalRuns[instruction.index];
+				if (incremental)
+					updateDirtyRun(run);
+				else
+					BoneKernel::updateNormal(_pose, _runBones.buffer() + run.firstBone, _runParents.buffer() + run.firstBone,
+											 _runLevelEnds.buffer() + run.firstLevel, run.lastLevel - run.firstLevel);
+				break;
+			}
+			case UpdateOp_IkConstraint:
+				_ikConstraints[instruction.index]->IkConstraint::update();
+				break;
+			case UpdateOp_TransformConstraint:
+				_transformConstraints[instruction.index]->TransformConstraint::update();
+				break;
+			case UpdateOp_PathConstraint:
+				_pathConstraints[instruction.index]->PathConstraint::update();
+				break;
+			case UpdateOp_Updatable:
+				_updateCache[instruction.index]->update();
+				break;
+		}
+	}
+}
+
+void Skeleton::compileBranches() {
+	_branchesValid = true;
+	_branchProgram.clear();
+	_branchStarts.clear();
+	// Drop the runs of previous branches, which follow the update program's runs. Each run's level ends are relative to
+	// its first bone, the last level end is its bone count.
+	size_t runBoneCount = 0, runLevelCount = 0;
+	if (_programRunCount > 0) {
+		NormalBoneRun &run = _normalRuns[_programRunCount - 1];
+		runLevelCount = run.lastLevel;
+		runBoneCount = run.firstBone + _runLevelEnds[run.lastLevel - 1];
+	}
+	_normalRuns.setSize(_programRunCount, NormalBoneRun());
+	_runBones.setSize(runBoneCount, 0);
+	_runParents.setSize(runBoneCount, 0);
+	_runLevelEnds.setSize(runLevelCount, 0);
+	size_t boneCount = _bones.size(), entryCount = _updateCache.size();
+	if (entryCount < _parallelBranchSize * 2 || _updateCache[0] != _bones[0]) return;
+
+	// The root bone is updated first and only read after that. Below it, bones are joined with their parent and with the
+	// other bones of their constraints, so each resulting subtree only reads and writes its own bones.
+	Vector<int> components;
+	components.setSize(boneCount, 0);
+	for (size_t i = 0; i < boneCount; i++) {
+		Bone *parent = _bones[i]->_parent;
+		components[i] = parent == NULL || parent->_parent == NULL ? (int) i : components[parent->_data.getIndex()];
+	}
+	Vector<int> entryBones;
+	entryBones.setSize(entryCount, 0);
+	for (size_t i = 1; i < entryCount; i++) {
 		Updatable *updatable = _updateCache[i];
-		if (updatable != rb) updatable->update();
+		Vector<Bone *> *constrained;
+		Bone *target;
+		if (updatable->getRTTI().isExactly(Bone::rtti)) {
+			entryBones[i] = static_cast<Bone *>(updatable)->_data.getIndex();
+			if (entryBones[i] == 0) return;
+			continue;
+		} else if (updatable->getRTTI().isExactly(IkConstraint::rtti)) {
+			constrained = &static_cast<IkConstraint *>(updatable)->getBones();
+			target = static_cast<IkConstraint *>(updatable)->getTarget();
+		} else if (updatable->getRTTI().isExactly(TransformConstraint::rtti)) {
+			constrained = &static_cast<TransformConstraint *>(updatable)->getBones();
+			target = static_cast<TransformConstraint *>(updatable)->getTarget();
+		} else {
+			// Path constraints read bones of attachments that can change, other updatables may touch any bone.
+			return;
+		}
+		if (constrained->size() == 0) return;
+		int component = findComponent(components, (*constrained)[0]->_data.getIndex());
+		for (size_t ii = 0, nn = constrained->size(); ii <= nn; ii++) {
+			Bone *bone = ii < nn ? (*constrained)[ii] : target;
+			// A constraint may read the root bone, but not change it.
+			if (bone->_parent == NULL) {
+				if (ii < nn) return;
+				continue;
+			}
+			components[findComponent(components, bone->_data.getIndex())] = component;
+		}
+		entryBones[i] = (*constrained)[0]->_data.getIndex();
+	}
+
+	// Bucket the entries by subtree, keeping the update cache order within each.
+	Vector<size_t> componentSizes;
+	componentSizes.setSize(boneCount, 0);
+	for (size_t i = 1; i < entryCount; i++) {
+		entryBones[i] = findComponent(components, entryBones[i]);
+		componentSizes[entryBones[i]]++;
+	}
+	Vector<size_t> componentStarts;
+	componentStarts.setSize(boneCount, 0);
+	for (size_t i = 0, offset = 0; i < boneCount; i++) {
+		componentStarts[i] = offset;
+		offset += componentSizes[i];
+	}
+	Vector<Updatable *> entries;
+	entries.setSize(entryCount - 1, NULL);
+	for (size_t i = 1; i < entryCount; i++)
+		entries[componentStarts[entryBones[i]]++] = _updateCache[i];
+
+	// Subtrees are packed into branches of at least _parallelBranchSize entries, a smaller remainder joins the last branch.
+	// Filling the entries advanced each start to the end of its subtree.
+	Vector<size_t> branchEnds;
+	for (size_t i = 0, size = 0; i < boneCount; i++) {
+		size += componentSizes[i];
+		if (size >= _parallelBranchSize) {
+			branchEnds.add(componentStarts[i]);
+			size = 0;
+		}
+	}
+	if (branchEnds.size() < 2) return;
+	branchEnds[branchEnds.size() - 1] = entryCount - 1;
+
+	appendUpdateProgram(_updateCache.buffer(), 1, _branchProgram);
+	for (size_t i = 0, start = 0; i < branchEnds.size(); i++) {
+		_branchStarts.add(_branchProgram.size());
+		appendUpdateProgram(entries.buffer() + start, branchEnds[i] - start, _branchProgram);
+		start = branchEnds[i];
+	}
+	_branchStarts.add(_branchProgram.size());
+}
+
+int Skeleton::findComponent(Vector<int> &components, int bone) {
+	while (components[bone] != bone) {
+		components[bone] = components[components[bone]];
+		bone = components[bone];
+	}
+	return bone;
+}
+
+void Skeleton::runBranches() {
+	runInstructions(_branchProgram.buffer(), _branchStarts[0], -1, false);
+	_taskRunner->run(runBranch, this, _branchStarts.size() - 1);
+}
+
+void Skeleton::runBranch(void *context, size_t index) {
+	Skeleton &skeleton = *static_cast<Skeleton *>(context);
+	size_t start = skeleton._branchStarts[index];
+	skeleton.runInstructions(skeleton._branchProgram.buffer() + start, skeleton._branchStarts[index + 1] - start, -1,
+							 false);
+}
+
+void Skeleton::setTaskRunner(TaskRunner *inValue) {
+	_taskRunner = inValue;
+}
+
+TaskRunner *Skeleton::getTaskRunner() {
+	return _taskRunner;
+}
+
+void Skeleton::setParallelBranchSize(size_t inValue) {
+	_parallelBranchSize = inValue > 0 ? inValue : 1;
+	_branchesValid = false;
+}
+
+size_t Skeleton::getParallelBranchSize() {
+	return _parallelBranchSize;
+}
+
+void Skeleton::updateDirtyRun(NormalBoneRun &run) {
+	// Keeps the run's level structure but only the bones that changed or have a parent that changed.
+	_dirtyRunBones.clear();
+	_dirtyRunParents.clear();
+	_dirtyLevelEnds.clear();
+	const int *bones = _runBones.buffer() + run.firstBone;
+	const int *parents = _runParents.buffer() + run.firstBone;
+	bool *dirty = _dirtyBones.buffer();
+	for (size_t level = run.firstLevel, start = 0; level < run.lastLevel; level++) {
+		size_t end = _runLevelEnds[level];
+		for (; start < end; start++) {
+			int bone = bones[start], parent = parents[start];
+			if (!dirty[bone] && !dirty[parent]) continue;
+			dirty[bone] = true;
+			_dirtyRunBones.add(bone);
+			_dirtyRunParents.add(parent);
+		}
+		if (_dirtyLevelEnds.size() == 0 || _dirtyLevelEnds[_dirtyLevelEnds.size() - 1] != _dirtyRunBones.size())
+			_dirtyLevelEnds.add(_dirtyRunBones.size());
 	}
+	if (_dirtyRunBones.size() > 0)
+		BoneKernel::updateNormal(_pose, _dirtyRunBones.buffer(), _dirtyRunParents.buffer(), _dirtyLevelEnds.buffer(),
+								 _dirtyLevelEnds.size());
 }
 
 void Skeleton::setToSetupPose() {
@@ -482,10 +1208,22 @@ Vector<Bone *> &Skeleton::getBones() {
 	return _bones;
 }
 
+SkeletonPose &Skeleton::getPose() {
+	return _pose;
+}
+
 Vector<Updatable *> &Skeleton::getUpdateCacheList() {
 	return _updateCache;
 }
 
+Vector<UpdateInstruction> &Skeleton::getUpdateProgram() {
+	return _updateProgram;
+}
+
+Vector<NormalBoneRun> &Skeleton::getNormalRuns() {
+	return _normalRuns;
+}
+
 Vector<Slot *> &Skeleton::getSlots() {
 	return _slots;
 }
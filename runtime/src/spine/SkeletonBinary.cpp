@@ -75,13 +75,17 @@ using namespace spine;
 
 SkeletonBinary::SkeletonBinary(Atlas *atlasArray) : _attachmentLoader(
 															new (__FILE__, __LINE__) AtlasAttachmentLoader(atlasArray)),
-													_error(), _scale(1), _ownsLoader(true) {
+													_error(), _scale(1), _rotateTolerance(-1),
+													_translateTolerance(-1), _removedFrames(0), _ownsLoader(true) {
 }
 
 SkeletonBinary::SkeletonBinary(AttachmentLoader *attachmentLoader, bool ownsLoader) : _attachmentLoader(
 																							  attachmentLoader),
 																					  _error(),
 																					  _scale(1),
+																					  _rotateTolerance(-1),
+																					  _translateTolerance(-1),
+																					  _removedFrames(0),
 																					  _ownsLoader(ownsLoader) {
 	assert(_attachmentLoader != NULL);
 }
@@ -102,6 +106,7 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	input->end = binary + length;
 
 	_linkedMeshes.clear();
+	_removedFrames = 0;
 
 	skeletonData = new (__FILE__, __LINE__) SkeletonData();
 
@@ -340,6 +345,7 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 			delete skeletonData;
 			return NULL;
 		}
+		animation->indexProperties(*skeletonData);
 		skeletonData->_animations[i] = animation;
 	}
 
@@ -1256,45 +1262,29 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 				switch (timelineType) {
 					case ATTACHMENT_DEFORM: {
 						VertexAttachment *attachment = static_cast<VertexAttachment *>(baseAttachment);
-						bool weighted = attachment->_bones.size() > 0;
-						Vector<float> &vertices = attachment->_vertices;
-						int deformLength = weighted ? (int) vertices.size() / 3 * 2 : (int) vertices.size();
 
 						int bezierCount = readVarint(input, true);
 						DeformTimeline *timeline = new (__FILE__, __LINE__) DeformTimeline(frameCount, bezierCount, slotIndex,
 																						   attachment);
 
+						// Frames are stored as offsets from the setup pose for the range of vertices they change.
+						Vector<float> offsets;
 						float time = readFloat(input);
 						for (int frame = 0, bezier = 0;; ++frame) {
-							Vector<float> deform;
-							size_t end = (size_t) readVarint(input, true);
-							if (end == 0) {
-								if (weighted) {
-									deform.setSize(deformLength, 0);
-									for (int iiii = 0; iiii < deformLength; ++iiii)
-										deform[iiii] = 0;
-								} else {
-									deform.clearAndAddAll(vertices);
-								}
-							} else {
-								deform.setSize(deformLength, 0);
-								size_t start = (size_t) readVarint(input, true);
-								end += start;
+							size_t end = (size_t) readVarint(input, true), start = 0;
+							offsets.setSize(end, 0);
+							if (end != 0) {
+								start = (size_t) readVarint(input, true);
 								if (scale == 1) {
-									for (size_t v = start; v < end; ++v)
-										deform[v] = readFloat(input);
+									for (size_t v = 0; v < end; ++v)
+										offsets[v] = readFloat(input);
 								} else {
-									for (size_t v = start; v < end; ++v)
-										deform[v] = readFloat(input) * scale;
-								}
-
-								if (!weighted) {
-									for (size_t v = 0, vn = deform.size(); v < vn; ++v)
-										deform[v] += vertices[v];
+									for (size_t v = 0; v < end; ++v)
+										offsets[v] = readFloat(input) * scale;
 								}
 							}
 
-							timeline->setFrame(frame, time, deform);
+							timeline->setFrame(frame, time, start, offsets);
 							if (frame == frameLast) break;
 							float time2 = readFloat(input);
 							switch (readSByte(input)) {
@@ -1393,6 +1383,8 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 		timelines.add(timeline);
 	}
 
+	_removedFrames += (int) CurveTimeline::removeRedundantFrames(timelines, _rotateTolerance, _translateTolerance);
+
 	float duration = 0;
 	for (int i = 0, n = (int) timelines.size(); i < n; i++) {
 		duration = MathUtil::max(duration, (timelines[i])->getDuration());
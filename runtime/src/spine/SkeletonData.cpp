@@ -34,14 +34,116 @@
 #include <spine/EventData.h>
 #include <spine/IkConstraintData.h>
 #include <spine/PathConstraintData.h>
+#include <spine/Skeleton.h>
+#include <spine/SkeletonUpdateOrder.h>
 #include <spine/Skin.h>
 #include <spine/SlotData.h>
+#include <spine/Timeline.h>
 #include <spine/TransformConstraintData.h>
 
 #include <spine/ContainerUtil.h>
 
+#include <mutex>
+
 using namespace spine;
 
+struct SkeletonData::UpdateOrderCache : public SpineObject {
+	std::mutex mutex;
+	Vector<SkeletonUpdateOrder *> orders;
+	/// Hash table of the orders, chained through SkeletonUpdateOrder::_nextInBucket. The size is a power of 2 and at
+	/// least twice the cache size.
+	Vector<SkeletonUpdateOrder *> buckets;
+	size_t size;
+	size_t next; // The oldest order, replaced next when full.
+	size_t lastId;
+
+	UpdateOrderCache() : size(0), next(0), lastId(0) {
+		resize(64);
+	}
+
+	~UpdateOrderCache() {
+		ContainerUtil::cleanUpVectorOfPointers(orders);
+	}
+
+	void resize(size_t newSize) {
+		ContainerUtil::cleanUpVectorOfPointers(orders);
+		size = newSize;
+		next = 0;
+		size_t bucketCount = 1;
+		while (bucketCount < size << 1) bucketCount <<= 1;
+		buckets.clear();
+		buckets.setSize(bucketCount, NULL);
+	}
+
+	SkeletonUpdateOrder *&bucket(size_t hash) {
+		// The key holds aligned pointers, mix the high bits into the low bits used for the index.
+		return buckets[(hash ^ (hash >> 16)) & (buckets.size() - 1)];
+	}
+
+	SkeletonUpdateOrder *find(Vector<const void *> &key, size_t hash) {
+		for (SkeletonUpdateOrder *order = bucket(hash); order; order = order->_nextInBucket)
+			if (order->matches(key, hash)) return order;
+		return NULL;
+	}
+
+	void remove(SkeletonUpdateOrder *order) {
+		SkeletonUpdateOrder **link = &bucket(order->_hash);
+		while (*link != order)
+			link = &(*link)->_nextInBucket;
+		*link = order->_nextInBucket;
+	}
+};
+
+struct SkeletonData::PropertyIndices : public SpineObject {
+	struct Entry {
+		PropertyId id;
+		int index; // -1 for an empty entry.
+	};
+
+	std::mutex mutex;
+	/// Open addressing hash table with linear probing. The size is a power of 2 and at least twice the count.
+	Vector<Entry> entries;
+	size_t count;
+
+	PropertyIndices() : count(0) {
+		resize(64);
+	}
+
+	static size_t hash(PropertyId id) {
+		// The property type is in the high bits, the bone, slot or constraint index in the low bits.
+		size_t hash = (size_t) ((unsigned long long) id ^ ((unsigned long long) id >> 32)) * 0x9E3779B1u;
+		return hash ^ (hash >> 15);
+	}
+
+	/// @return The entry of the ID, or the empty entry where it would be added.
+	Entry &find(PropertyId id) {
+		size_t mask = entries.size() - 1;
+		for (size_t i = hash(id) & mask;; i = (i + 1) & mask) {
+			Entry &entry = entries[i];
+			if (entry.index == -1 || entry.id == id) return entry;
+		}
+	}
+
+	void resize(size_t capacity) {
+		Vector<Entry> old;
+		old.clearAndAddAll(entries);
+		Entry empty = {0, -1};
+		entries.clear();
+		entries.setSize(capacity, empty);
+		for (size_t i = 0, n = old.size(); i < n; i++)
+			if (old[i].index != -1) find(old[i].id) = old[i];
+	}
+
+	int indexOf(PropertyId id) {
+		Entry &entry = find(id);
+		if (entry.index != -1) return entry.index;
+		entry.id = id;
+		entry.index = (int) count++;
+		if (count << 1 > entries.size()) resize(entries.size() << 1);
+		return (int) count - 1;
+	}
+};
+
 SkeletonData::SkeletonData() : _name(),
 							   _defaultSkin(NULL),
 							   _x(0),
@@ -50,6 +152,8 @@ SkeletonData::SkeletonData() : _name(),
 							   _height(0),
 							   _version(),
 							   _hash(),
+							   _updateOrderCache(new (__FILE__, __LINE__) UpdateOrderCache()),
+							   _propertyIndices(new (__FILE__, __LINE__) PropertyIndices()),
 							   _fps(0),
 							   _imagesPath() {
 }
@@ -66,6 +170,8 @@ SkeletonData::~SkeletonData() {
 	ContainerUtil::cleanUpVectorOfPointers(_ikConstraints);
 	ContainerUtil::cleanUpVectorOfPointers(_transformConstraints);
 	ContainerUtil::cleanUpVectorOfPointers(_pathConstraints);
+	delete _updateOrderCache;
+	delete _propertyIndices;
 	for (size_t i = 0; i < _strings.size(); i++) {
 		SpineExtension::free(_strings[i], __FILE__, __LINE__);
 	}
@@ -151,6 +257,41 @@ Vector<PathConstraintData *> &SkeletonData::getPathConstraints() {
 	return _pathConstraints;
 }
 
+int SkeletonData::getPropertyIndex(PropertyId id) {
+	std::lock_guard<std::mutex> lock(_propertyIndices->mutex);
+	return _propertyIndices->indexOf(id);
+}
+
+size_t SkeletonData::getPropertyCount() {
+	std::lock_guard<std::mutex> lock(_propertyIndices->mutex);
+	return _propertyIndices->count;
+}
+
+void SkeletonData::indexProperties(Animation &animation) {
+	// An animation without timelines has nothing to index. This also leaves AnimationState's empty animation, which is
+	// shared by all skeleton data, untouched.
+	if (animation._timelines.size() == 0) return;
+	std::lock_guard<std::mutex> lock(_propertyIndices->mutex);
+	if (animation._propertyIndexData == this) return;
+	animation._propertyIndexData = this;
+	animation._propertyIndices.clear();
+	animation._propertyStarts.clear();
+	animation._propertyBits.clear();
+	Vector<Timeline *> &timelines = animation._timelines;
+	for (size_t i = 0, n = timelines.size(); i < n; i++) {
+		animation._propertyStarts.add((int) animation._propertyIndices.size());
+		Vector<PropertyId> &ids = timelines[i]->getPropertyIds();
+		for (size_t ii = 0; ii < ids.size(); ii++) {
+			int index = _propertyIndices->indexOf(ids[ii]);
+			animation._propertyIndices.add(index);
+			size_t word = (size_t) index >> 5;
+			if (word >= animation._propertyBits.size()) animation._propertyBits.setSize(word + 1, 0);
+			animation._propertyBits[word] |= 1u << (index & 31);
+		}
+	}
+	animation._propertyStarts.add((int) animation._propertyIndices.size());
+}
+
 float SkeletonData::getX() {
 	return _x;
 }
@@ -223,3 +364,45 @@ float SkeletonData::getFps() {
 void SkeletonData::setFps(float inValue) {
 	_fps = inValue;
 }
+
+size_t SkeletonData::getUpdateOrderCacheSize() {
+	std::lock_guard<std::mutex> lock(_updateOrderCache->mutex);
+	return _updateOrderCache->size;
+}
+
+void SkeletonData::setUpdateOrderCacheSize(size_t inValue) {
+	std::lock_guard<std::mutex> lock(_updateOrderCache->mutex);
+	_updateOrderCache->resize(inValue);
+}
+
+bool SkeletonData::findUpdateOrder(Skeleton &skeleton, size_t hash) {
+	std::lock_guard<std::mutex> lock(_updateOrderCache->mutex);
+	SkeletonUpdateOrder *order = _updateOrderCache->find(skeleton._updateOrderKey, hash);
+	if (!order) return false;
+	skeleton.loadUpdateOrder(*order);
+	return true;
+}
+
+void SkeletonData::addUpdateOrder(Skeleton &skeleton, size_t hash) {
+	std::lock_guard<std::mutex> lock(_updateOrderCache->mutex);
+	UpdateOrderCache &cache = *_updateOrderCache;
+	SkeletonUpdateOrder *order = cache.find(skeleton._updateOrderKey, hash);
+	if (order) {
+		skeleton._updateOrderId = order->_id;
+		return;
+	}
+	skeleton._updateOrderId = ++cache.lastId;
+	if (cache.size == 0) return;
+	order = skeleton.saveUpdateOrder(hash);
+	if (cache.orders.size() < cache.size)
+		cache.orders.add(order);
+	else {
+		cache.remove(cache.orders[cache.next]);
+		delete cache.orders[cache.next];
+		cache.orders[cache.next] = order;
+		cache.next = (cache.next + 1) % cache.size;
+	}
+	SkeletonUpdateOrder *&bucket = cache.bucket(hash);
+	order->_nextInBucket = bucket;
+	bucket = order;
+}
@@ -0,0 +1,127 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/SkeletonInstanceBatch.h>
+
+#include <spine/Bone.h>
+#include <spine/BoneKernel.h>
+#include <spine/IkConstraint.h>
+#include <spine/PathConstraint.h>
+#include <spine/Skeleton.h>
+#include <spine/TransformConstraint.h>
+
+using namespace spine;
+
+SkeletonInstanceBatch::SkeletonInstanceBatch() {
+}
+
+SkeletonInstanceBatch::~SkeletonInstanceBatch() {
+}
+
+void SkeletonInstanceBatch::updateWorldTransform(Vector<Skeleton *> &skeletons) {
+	updateWorldTransform(skeletons.buffer(), skeletons.size());
+}
+
+void SkeletonInstanceBatch::updateWorldTransform(Skeleton **skeletons, size_t count) {
+	_pending.clear();
+	for (size_t i = 0; i < count; i++) {
+		Skeleton *skeleton = skeletons[i];
+		if (skeleton->_incrementalUpdate || skeleton->_updateOrderId == 0 ||
+			skeleton->_updateCache.size() != skeleton->_programCacheSize)
+			skeleton->updateWorldTransform();
+		else
+			_pending.add(skeleton);
+	}
+
+	// Each pass takes the skeletons sharing the update order of the first pending one.
+	while (_pending.size() > 0) {
+		size_t order = _pending[0]->_updateOrderId;
+		_group.clear();
+		size_t remaining = 0;
+		for (size_t i = 0, n = _pending.size(); i < n; i++) {
+			Skeleton *skeleton = _pending[i];
+			if (skeleton->_updateOrderId == order)
+				_group.add(skeleton);
+			else
+				_pending[remaining++] = skeleton;
+		}
+		_pending.setSize(remaining, NULL);
+		updateGroup();
+	}
+}
+
+void SkeletonInstanceBatch::updateGroup() {
+	for (size_t start = 0, n = _group.size(); start < n; start += TileSize)
+		updateTile(_group.buffer() + start, n - start < TileSize ? n - start : TileSize);
+}
+
+void SkeletonInstanceBatch::updateTile(Skeleton **group, size_t count) {
+	_poses.clear();
+	for (size_t i = 0; i < count; i++) {
+		group[i]->_pose.resetAppliedTransforms();
+		_poses.add(&group[i]->_pose);
+	}
+
+	Skeleton &lead = *group[0];
+	const UpdateInstruction *program = lead._updateProgram.buffer();
+	for (size_t i = 0, n = lead._updateProgram.size(); i < n; i++) {
+		const UpdateInstruction &instruction = program[i];
+		int index = instruction.index;
+		switch (instruction.op) {
+			case UpdateOp_Bone:
+				for (size_t ii = 0; ii < count; ii++)
+					group[ii]->_bones[index]->Bone::update();
+				break;
+			case UpdateOp_NormalRun: {
+				NormalBoneRun &run = lead._normalRuns[index];
+				size_t firstBone = run.firstBone;
+				size_t boneCount = lead._runLevelEnds[run.lastLevel - 1];
+				BoneKernel::updateNormalInstances(_poses.buffer(), count, lead._runBones.buffer() + firstBone,
+												  lead._runParents.buffer() + firstBone, boneCount);
+				break;
+			}
+			case UpdateOp_IkConstraint:
+				for (size_t ii = 0; ii < count; ii++)
+					group[ii]->_ikConstraints[index]->IkConstraint::update();
+				break;
+			case UpdateOp_TransformConstraint:
+				for (size_t ii = 0; ii < count; ii++)
+					group[ii]->_transformConstraints[index]->TransformConstraint::update();
+				break;
+			case UpdateOp_PathConstraint:
+				for (size_t ii = 0; ii < count; ii++)
+					group[ii]->_pathConstraints[index]->PathConstraint::update();
+				break;
+			case UpdateOp_Updatable:
+				for (size_t ii = 0; ii < count; ii++)
+					group[ii]->_updateCache[index]->update();
+				break;
+		}
+	}
+}
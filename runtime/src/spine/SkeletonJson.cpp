@@ -99,10 +99,14 @@ static void toColor(Color &color, const char *value, bool hasAlpha) {
 }
 
 SkeletonJson::SkeletonJson(Atlas *atlas) : _attachmentLoader(new (__FILE__, __LINE__) AtlasAttachmentLoader(atlas)),
-										   _scale(1), _ownsLoader(true) {}
+										   _scale(1), _rotateTolerance(-1), _translateTolerance(-1), _removedFrames(0),
+										   _ownsLoader(true) {}
 
 SkeletonJson::SkeletonJson(AttachmentLoader *attachmentLoader, bool ownsLoader) : _attachmentLoader(attachmentLoader),
 																				  _scale(1),
+																				  _rotateTolerance(-1),
+																				  _translateTolerance(-1),
+																				  _removedFrames(0),
 																				  _ownsLoader(ownsLoader) {
 	assert(_attachmentLoader != NULL);
 }
@@ -136,6 +140,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 
 	_error = "";
 	_linkedMeshes.clear();
+	_removedFrames = 0;
 
 	root = new (__FILE__, __LINE__) Json(json);
 
@@ -774,6 +779,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 				delete root;
 				return NULL;
 			}
+			animation->indexProperties(*skeletonData);
 			skeletonData->_animations[animationsIndex++] = animation;
 		}
 	}
@@ -1276,43 +1282,22 @@ Animation *SkeletonJson::readAnimation(Json *root, SkeletonData *skeletonData) {
 					String timelineName = timelineMap->_name;
 					if (timelineName == "deform") {
 						VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(attachment);
-						bool weighted = vertexAttachment->_bones.size() != 0;
-						Vector<float> &verts = vertexAttachment->_vertices;
-						int deformLength = weighted ? (int) verts.size() / 3 * 2 : (int) verts.size();
 
 						DeformTimeline *timeline = new (__FILE__, __LINE__) DeformTimeline(frames,
 																						   frames, slotIndex, vertexAttachment);
+						// Frames are stored as offsets from the setup pose for the range of vertices they change.
+						Vector<float> offsets;
 						float time = Json::getFloat(keyMap, "time", 0);
 						for (frame = 0, bezier = 0;; frame++) {
 							Json *vertices = Json::getItem(keyMap, "vertices");
-							Vector<float> deformed;
-							if (!vertices) {
-								if (weighted) {
-									deformed.setSize(deformLength, 0);
-								} else {
-									deformed.clearAndAddAll(vertexAttachment->_vertices);
-								}
-							} else {
-								deformed.setSize(deformLength, 0);
-								int v, start = Json::getInt(keyMap, "offset", 0);
-								Json *vertex;
-								if (_scale == 1) {
-									for (vertex = vertices->_child, v = start; vertex; vertex = vertex->_next, ++v) {
-										deformed[v] = vertex->_valueFloat;
-									}
-								} else {
-									for (vertex = vertices->_child, v = start; vertex; vertex = vertex->_next, ++v) {
-										deformed[v] = vertex->_valueFloat * _scale;
-									}
-								}
-								if (!weighted) {
-									Vector<float> &verticesAttachment = vertexAttachment->_vertices;
-									for (v = 0; v < deformLength; ++v) {
-										deformed[v] += verticesAttachment[v];
-									}
-								}
+							int start = 0;
+							offsets.clear();
+							if (vertices) {
+								start = Json::getInt(keyMap, "offset", 0);
+								for (Json *vertex = vertices->_child; vertex; vertex = vertex->_next)
+									offsets.add(vertex->_valueFloat * _scale);
 							}
-							timeline->setFrame(frame, time, deformed);
+							timeline->setFrame(frame, time, (size_t) start, offsets);
 							nextMap = keyMap->_next;
 							if (!nextMap) {
 								// timeline.shrink(); // BOZO
@@ -1421,6 +1406,8 @@ Animation *SkeletonJson::readAnimation(Json *root, SkeletonData *skeletonData) {
 		timelines.add(timeline);
 	}
 
+	_removedFrames += (int) CurveTimeline::removeRedundantFrames(timelines, _rotateTolerance, _translateTolerance);
+
 	float duration = 0;
 	for (size_t i = 0; i < timelines.size(); i++)
 		duration = MathUtil::max(duration, timelines[i]->getDuration());
@@ -0,0 +1,67 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/SkeletonPose.h>
+
+#include <spine/Extension.h>
+
+#include <assert.h>
+#include <string.h>
+
+using namespace spine;
+
+SkeletonPose::SkeletonPose(size_t boneCount) : _boneCount(boneCount),
+											   _stride((boneCount + 3) & ~(size_t) 3),
+											   _buffer(NULL) {
+	if (_stride > 0) _buffer = SpineExtension::calloc<float>(_stride * PoseChannel_Count, __FILE__, __LINE__);
+}
+
+SkeletonPose::~SkeletonPose() {
+	if (_buffer) SpineExtension::free(_buffer, __FILE__, __LINE__);
+}
+
+size_t SkeletonPose::getBoneCount() {
+	return _boneCount;
+}
+
+size_t SkeletonPose::getStride() {
+	return _stride;
+}
+
+void SkeletonPose::resetAppliedTransforms() {
+	if (!_buffer) return;
+	// The local and applied channels are laid out in the same order, so this is a single block copy.
+	memcpy(_buffer + PoseChannel_AX * _stride, _buffer + PoseChannel_X * _stride,
+		   sizeof(float) * _stride * (PoseChannel_AX - PoseChannel_X));
+}
+
+void SkeletonPose::set(SkeletonPose &pose) {
+	assert(pose._stride == _stride);
+	if (_buffer) memcpy(_buffer, pose._buffer, sizeof(float) * _stride * PoseChannel_Count);
+}
@@ -49,6 +49,18 @@ Slot::Slot(SlotData &data, Bone &bone) : _data(data),
 	setToSetupPose();
 }
 
+Slot::Slot(Slot &prototype, Bone &bone) : _data(prototype._data),
+										  _bone(bone),
+										  _skeleton(bone.getSkeleton()),
+										  _color(prototype._color),
+										  _darkColor(prototype._darkColor),
+										  _hasDarkColor(prototype._hasDarkColor),
+										  _attachment(prototype._attachment),
+										  _attachmentState(prototype._attachmentState),
+										  _sequenceIndex(prototype._sequenceIndex) {
+	_deform.clearAndAddAll(prototype._deform);
+}
+
 void Slot::setToSetupPose() {
 	_color.set(_data.getColor());
 	if (_hasDarkColor) _darkColor.set(_data.getDarkColor());
@@ -0,0 +1,119 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/TaskRunner.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace spine;
+
+TaskRunner::~TaskRunner() {
+}
+
+struct ThreadPoolTaskRunner::Workers : public SpineObject {
+	std::vector<std::thread> threads;
+	std::mutex mutex;
+	std::condition_variable start;
+	std::condition_variable done;
+	size_t generation;
+	size_t pending;
+	bool stop;
+	Task task;
+	void *context;
+	size_t count;
+	std::atomic<size_t> next;
+
+	Workers() : generation(0), pending(0), stop(false), task(NULL), context(NULL), count(0), next(0) {
+	}
+
+	void work() {
+		for (size_t i; (i = next.fetch_add(1)) < count;)
+			task(context, i);
+	}
+
+	void loop() {
+		size_t seen = 0;
+		for (;;) {
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				while (!stop && generation == seen)
+					start.wait(lock);
+				if (stop) return;
+				seen = generation;
+			}
+			work();
+			std::lock_guard<std::mutex> lock(mutex);
+			if (--pending == 0) done.notify_one();
+		}
+	}
+};
+
+ThreadPoolTaskRunner::ThreadPoolTaskRunner(int threadCount) : _workers(new (__FILE__, __LINE__) Workers()) {
+	for (int i = 0; i < threadCount; i++)
+		_workers->threads.push_back(std::thread(&Workers::loop, _workers));
+}
+
+ThreadPoolTaskRunner::~ThreadPoolTaskRunner() {
+	{
+		std::lock_guard<std::mutex> lock(_workers->mutex);
+		_workers->stop = true;
+	}
+	_workers->start.notify_all();
+	for (size_t i = 0; i < _workers->threads.size(); i++)
+		_workers->threads[i].join();
+	delete _workers;
+}
+
+void ThreadPoolTaskRunner::run(Task task, void *context, size_t count) {
+	Workers &workers = *_workers;
+	if (workers.threads.empty() || count < 2) {
+		for (size_t i = 0; i < count; i++)
+			task(context, i);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(workers.mutex);
+		workers.task = task;
+		workers.context = context;
+		workers.count = count;
+		workers.next = 0;
+		workers.pending = workers.threads.size();
+		workers.generation++;
+	}
+	workers.start.notify_all();
+	workers.work();
+	std::unique_lock<std::mutex> lock(workers.mutex);
+	while (workers.pending != 0)
+		workers.done.wait(lock);
+}
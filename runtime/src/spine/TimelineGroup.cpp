@@ -0,0 +1,204 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/TimelineGroup.h>
+
+#include <spine/Animation.h>
+#include <spine/Bone.h>
+#include <spine/BoneData.h>
+#include <spine/RotateTimeline.h>
+#include <spine/ShearTimeline.h>
+#include <spine/Skeleton.h>
+#include <spine/TranslateTimeline.h>
+
+using namespace spine;
+
+static float getSetupValue(BoneData &data, PoseChannel channel) {
+	switch (channel) {
+		case PoseChannel_X:
+			return data.getX();
+		case PoseChannel_Y:
+			return data.getY();
+		case PoseChannel_Rotation:
+			return data.getRotation();
+		case PoseChannel_ShearX:
+			return data.getShearX();
+		case PoseChannel_ShearY:
+			return data.getShearY();
+		default:
+			return 0;
+	}
+}
+
+static inline void applyValue(float &current, float setup, float value, float alpha, MixBlend blend, bool rotate) {
+	switch (blend) {
+		case MixBlend_Setup:
+			current = setup + value * alpha;
+			break;
+		case MixBlend_First:
+		case MixBlend_Replace:
+			// Same operation order as RotateTimeline and the other timelines, so the results are identical.
+			if (rotate)
+				current += (value + (setup - current)) * alpha;
+			else
+				current += (setup + value - current) * alpha;
+			break;
+		case MixBlend_Add:
+			current += value * alpha;
+	}
+}
+
+static inline void applyBeforeFirstFrame(float &current, float setup, float alpha, MixBlend blend) {
+	switch (blend) {
+		case MixBlend_Setup:
+			current = setup;
+			break;
+		case MixBlend_First:
+			current += (setup - current) * alpha;
+		default: {
+		}
+	}
+}
+
+TimelineGroup::TimelineGroup(Timeline *timeline) : _type(timeline->getRTTI()), _channel1(PoseChannel_Count),
+												   _channel2(PoseChannel_Count), _rotate(false),
+												   _sharedFrames(true) {
+	const RTTI &type = timeline->getRTTI();
+	if (type.isExactly(RotateTimeline::rtti)) {
+		_channel1 = PoseChannel_Rotation;
+		_rotate = true;
+	} else if (type.isExactly(TranslateTimeline::rtti)) {
+		_channel1 = PoseChannel_X;
+		_channel2 = PoseChannel_Y;
+	} else if (type.isExactly(TranslateXTimeline::rtti))
+		_channel1 = PoseChannel_X;
+	else if (type.isExactly(TranslateYTimeline::rtti))
+		_channel1 = PoseChannel_Y;
+	else if (type.isExactly(ShearTimeline::rtti)) {
+		_channel1 = PoseChannel_ShearX;
+		_channel2 = PoseChannel_ShearY;
+	} else if (type.isExactly(ShearXTimeline::rtti))
+		_channel1 = PoseChannel_ShearX;
+	else if (type.isExactly(ShearYTimeline::rtti))
+		_channel1 = PoseChannel_ShearY;
+}
+
+TimelineGroup::~TimelineGroup() {
+}
+
+bool TimelineGroup::isGroupable(Timeline *timeline) {
+	const RTTI &type = timeline->getRTTI();
+	return type.isExactly(RotateTimeline::rtti) || type.isExactly(TranslateTimeline::rtti) ||
+		   type.isExactly(TranslateXTimeline::rtti) || type.isExactly(TranslateYTimeline::rtti) ||
+		   type.isExactly(ShearTimeline::rtti) || type.isExactly(ShearXTimeline::rtti) ||
+		   type.isExactly(ShearYTimeline::rtti);
+}
+
+void TimelineGroup::add(Timeline *timeline, int timelineIndex) {
+	if (_timelines.size() > 0 && _sharedFrames) {
+		Vector<float> &frames = _timelines[0]->getFrames(), &otherFrames = timeline->getFrames();
+		if (frames.size() != otherFrames.size())
+			_sharedFrames = false;
+		else {
+			for (size_t i = 0, n = frames.size(), step = timeline->getFrameEntries(); i < n; i += step) {
+				if (frames[i] != otherFrames[i]) {
+					_sharedFrames = false;
+					break;
+				}
+			}
+		}
+	}
+
+	// The property ID of these timelines is their type's property and the bone index.
+	_timelines.add(static_cast<CurveTimeline *>(timeline));
+	_timelineIndices.add(timelineIndex);
+	_boneIndices.add((int) (timeline->getPropertyIds()[0] & 0xffffffff));
+}
+
+void TimelineGroup::apply(Skeleton &skeleton, float time, float alpha, MixBlend blend, int *cursors) {
+	size_t count = _timelines.size();
+	if (count == 0) return;
+
+	// With shared frames, the frame found for the first timeline is the frame of every timeline.
+	int frame = -1;
+	if (_sharedFrames) {
+		Vector<float> &frames = _timelines[0]->getFrames();
+		if (!(time < frames[0])) {
+			frame = Animation::search(frames, time, (int) _timelines[0]->getFrameEntries(),
+									  cursors ? &cursors[_timelineIndices[0]] : NULL);
+		}
+	}
+
+	Bone **bones = skeleton.getBones().buffer();
+	float *values1 = skeleton.getPose().getChannel(_channel1);
+	float *values2 = _channel2 != PoseChannel_Count ? skeleton.getPose().getChannel(_channel2) : NULL;
+	for (size_t i = 0; i < count; i++) {
+		int boneIndex = _boneIndices[i];
+		Bone *bone = bones[boneIndex];
+		if (!bone->isActive()) continue;
+		BoneData &data = bone->getData();
+		CurveTimeline *timeline = _timelines[i];
+		int timelineFrame = frame;
+		if (!_sharedFrames) {
+			Vector<float> &frames = timeline->getFrames();
+			if (!(time < frames[0])) {
+				timelineFrame = Animation::search(frames, time, (int) timeline->getFrameEntries(),
+												  cursors ? &cursors[_timelineIndices[i]] : NULL);
+			}
+		}
+		if (timelineFrame == -1) {
+			applyBeforeFirstFrame(values1[boneIndex], getSetupValue(data, _channel1), alpha, blend);
+			if (values2) applyBeforeFirstFrame(values2[boneIndex], getSetupValue(data, _channel2), alpha, blend);
+		} else if (values2) {
+			float value1, value2;
+			static_cast<CurveTimeline2 *>(timeline)->getCurveValues(time, timelineFrame, value1, value2);
+			applyValue(values1[boneIndex], getSetupValue(data, _channel1), value1, alpha, blend, false);
+			applyValue(values2[boneIndex], getSetupValue(data, _channel2), value2, alpha, blend, false);
+		} else {
+			float value = static_cast<CurveTimeline1 *>(timeline)->getCurveValue(time, timelineFrame);
+			applyValue(values1[boneIndex], getSetupValue(data, _channel1), value, alpha, blend, _rotate);
+		}
+	}
+}
+
+const RTTI &TimelineGroup::getType() {
+	return _type;
+}
+
+Vector<CurveTimeline *> &TimelineGroup::getTimelines() {
+	return _timelines;
+}
+
+Vector<int> &TimelineGroup::getTimelineIndices() {
+	return _timelineIndices;
+}
+
+bool TimelineGroup::hasSharedFrames() {
+	return _sharedFrames;
+}
@@ -41,8 +41,7 @@ RTTI_IMPL(TransformConstraint, Updatable)
 
 TransformConstraint::TransformConstraint(TransformConstraintData &data, Skeleton &skeleton) : Updatable(),
 																							  _data(data),
-																							  _target(skeleton.findBone(
-																									  data.getTarget()->getName())),
+																							  _target(skeleton.getBones()[data.getTarget()->getIndex()]),
 																							  _mixRotate(
 																									  data.getMixRotate()),
 																							  _mixX(data.getMixX()),
@@ -57,7 +56,7 @@ TransformConstraint::TransformConstraint(TransformConstraintData &data, Skeleton
 	_bones.ensureCapacity(_data.getBones().size());
 	for (size_t i = 0; i < _data.getBones().size(); ++i) {
 		BoneData *boneData = _data.getBones()[i];
-		_bones.add(skeleton.findBone(boneData->getName()));
+		_bones.add(skeleton.getBones()[boneData->getIndex()]);
 	}
 }
 
@@ -149,7 +148,7 @@ void TransformConstraint::applyAbsoluteWorld() {
 	float mixRotate = _mixRotate, mixX = _mixX, mixY = _mixY, mixScaleX = _mixScaleX, mixScaleY = _mixScaleY, mixShearY = _mixShearY;
 	bool translate = mixX != 0 || mixY != 0;
 	Bone &target = *_target;
-	float ta = target._a, tb = target._b, tc = target._c, td = target._d;
+	float ta = target._a(), tb = target._b(), tc = target._c(), td = target._d();
 	float degRadReflect = ta * td - tb * tc > 0 ? MathUtil::Deg_Rad : -MathUtil::Deg_Rad;
 	float offsetRotation = _data._offsetRotation * degRadReflect, offsetShearY = _data._offsetShearY * degRadReflect;
 
@@ -158,7 +157,7 @@ void TransformConstraint::applyAbsoluteWorld() {
 		Bone &bone = *item;
 
 		if (mixRotate != 0) {
-			float a = bone._a, b = bone._b, c = bone._c, d = bone._d;
+			float a = bone._a(), b = bone._b(), c = bone._c(), d = bone._d();
 			float r = MathUtil::atan2(tc, ta) - MathUtil::atan2(c, a) + offsetRotation;
 			if (r > MathUtil::Pi)
 				r -= MathUtil::Pi_2;
@@ -167,37 +166,37 @@ void TransformConstraint::applyAbsoluteWorld() {
 
 			r *= mixRotate;
 			float cos = MathUtil::cos(r), sin = MathUtil::sin(r);
-			bone._a = cos * a - sin * c;
-			bone._b = cos * b - sin * d;
-			bone._c = sin * a + cos * c;
-			bone._d = sin * b + cos * d;
+			bone._a() = cos * a - sin * c;
+			bone._b() = cos * b - sin * d;
+			bone._c() = sin * a + cos * c;
+			bone._d() = sin * b + cos * d;
 		}
 
 		if (translate) {
 			float tx, ty;
 			target.localToWorld(_data._offsetX, _data._offsetY, tx, ty);
-			bone._worldX += (tx - bone._worldX) * mixX;
-			bone._worldY += (ty - bone._worldY) * mixY;
+			bone._worldX() += (tx - bone._worldX()) * mixX;
+			bone._worldY() += (ty - bone._worldY()) * mixY;
 		}
 
 		if (mixScaleX > 0) {
-			float s = MathUtil::sqrt(bone._a * bone._a + bone._c * bone._c);
+			float s = MathUtil::sqrt(bone._a() * bone._a() + bone._c() * bone._c());
 			if (s != 0) s = (s + (MathUtil::sqrt(ta * ta + tc * tc) - s + _data._offsetScaleX) * mixScaleX) / s;
-			bone._a *= s;
-			bone._c *= s;
+			bone._a() *= s;
+			bone._c() *= s;
 		}
 
 		if (mixScaleY > 0) {
-			float s = MathUtil::sqrt(bone._b * bone._b + bone._d * bone._d);
+			float s = MathUtil::sqrt(bone._b() * bone._b() + bone._d() * bone._d());
 			if (s != 0) s = (s + (MathUtil::sqrt(tb * tb + td * td) - s + _data._offsetScaleY) * mixScaleY) / s;
-			bone._b *= s;
-			bone._d *= s;
+			bone._b() *= s;
+			bone._d() *= s;
 		}
 
 		if (mixShearY > 0) {
-			float b = bone._b, d = bone._d;
+			float b = bone._b(), d = bone._d();
 			float by = MathUtil::atan2(d, b);
-			float r = MathUtil::atan2(td, tb) - MathUtil::atan2(tc, ta) - (by - MathUtil::atan2(bone._c, bone._a));
+			float r = MathUtil::atan2(td, tb) - MathUtil::atan2(tc, ta) - (by - MathUtil::atan2(bone._c(), bone._a()));
 			if (r > MathUtil::Pi)
 				r -= MathUtil::Pi_2;
 			else if (r < -MathUtil::Pi)
@@ -205,8 +204,8 @@ void TransformConstraint::applyAbsoluteWorld() {
 
 			r = by + (r + offsetShearY) * mixShearY;
 			float s = MathUtil::sqrt(b * b + d * d);
-			bone._b = MathUtil::cos(r) * s;
-			bone._d = MathUtil::sin(r) * s;
+			bone._b() = MathUtil::cos(r) * s;
+			bone._d() = MathUtil::sin(r) * s;
 		}
 
 		bone.updateAppliedTransform();
@@ -217,7 +216,7 @@ void TransformConstraint::applyRelativeWorld() {
 	float mixRotate = _mixRotate, mixX = _mixX, mixY = _mixY, mixScaleX = _mixScaleX, mixScaleY = _mixScaleY, mixShearY = _mixShearY;
 	bool translate = mixX != 0 || mixY != 0;
 	Bone &target = *_target;
-	float ta = target._a, tb = target._b, tc = target._c, td = target._d;
+	float ta = target._a(), tb = target._b(), tc = target._c(), td = target._d();
 	float degRadReflect = ta * td - tb * tc > 0 ? MathUtil::Deg_Rad : -MathUtil::Deg_Rad;
 	float offsetRotation = _data._offsetRotation * degRadReflect, offsetShearY = _data._offsetShearY * degRadReflect;
 	for (size_t i = 0; i < _bones.size(); ++i) {
@@ -225,7 +224,7 @@ void TransformConstraint::applyRelativeWorld() {
 		Bone &bone = *item;
 
 		if (mixRotate != 0) {
-			float a = bone._a, b = bone._b, c = bone._c, d = bone._d;
+			float a = bone._a(), b = bone._b(), c = bone._c(), d = bone._d();
 			float r = MathUtil::atan2(tc, ta) + offsetRotation;
 			if (r > MathUtil::Pi)
 				r -= MathUtil::Pi_2;
@@ -234,28 +233,28 @@ void TransformConstraint::applyRelativeWorld() {
 
 			r *= mixRotate;
 			float cos = MathUtil::cos(r), sin = MathUtil::sin(r);
-			bone._a = cos * a - sin * c;
-			bone._b = cos * b - sin * d;
-			bone._c = sin * a + cos * c;
-			bone._d = sin * b + cos * d;
+			bone._a() = cos * a - sin * c;
+			bone._b() = cos * b - sin * d;
+			bone._c() = sin * a + cos * c;
+			bone._d() = sin * b + cos * d;
 		}
 
 		if (translate) {
 			float tx, ty;
 			target.localToWorld(_data._offsetX, _data._offsetY, tx, ty);
-			bone._worldX += tx * mixX;
-			bone._worldY += ty * mixY;
+			bone._worldX() += tx * mixX;
+			bone._worldY() += ty * mixY;
 		}
 
 		if (mixScaleX != 0) {
 			float s = (MathUtil::sqrt(ta * ta + tc * tc) - 1 + _data._offsetScaleX) * mixScaleX + 1;
-			bone._a *= s;
-			bone._c *= s;
+			bone._a() *= s;
+			bone._c() *= s;
 		}
 		if (mixScaleY != 0) {
 			float s = (MathUtil::sqrt(tb * tb + td * td) - 1 + _data._offsetScaleY) * mixScaleY + 1;
-			bone._b *= s;
-			bone._d *= s;
+			bone._b() *= s;
+			bone._d() *= s;
 		}
 
 		if (mixShearY > 0) {
@@ -265,11 +264,11 @@ void TransformConstraint::applyRelativeWorld() {
 			else if (r < -MathUtil::Pi)
 				r += MathUtil::Pi_2;
 
-			float b = bone._b, d = bone._d;
+			float b = bone._b(), d = bone._d();
 			r = MathUtil::atan2(d, b) + (r - MathUtil::Pi / 2 + offsetShearY) * mixShearY;
 			float s = MathUtil::sqrt(b * b + d * d);
-			bone._b = MathUtil::cos(r) * s;
-			bone._d = MathUtil::sin(r) * s;
+			bone._b() = MathUtil::cos(r) * s;
+			bone._d() = MathUtil::sin(r) * s;
 		}
 
 		bone.updateAppliedTransform();
@@ -284,31 +283,31 @@ void TransformConstraint::applyAbsoluteLocal() {
 		Bone *item = _bones[i];
 		Bone &bone = *item;
 
-		float rotation = bone._arotation;
+		float rotation = bone._arotation();
 		if (mixRotate != 0) {
-			float r = target._arotation - rotation + _data._offsetRotation;
+			float r = target._arotation() - rotation + _data._offsetRotation;
 			r -= (16384 - (int) (16384.499999999996 - r / 360)) * 360;
 			rotation += r * mixRotate;
 		}
 
-		float x = bone._ax, y = bone._ay;
-		x += (target._ax - x + _data._offsetX) * mixX;
-		y += (target._ay - y + _data._offsetY) * mixY;
+		float x = bone._ax(), y = bone._ay();
+		x += (target._ax() - x + _data._offsetX) * mixX;
+		y += (target._ay() - y + _data._offsetY) * mixY;
 
-		float scaleX = bone._ascaleX, scaleY = bone._ascaleY;
+		float scaleX = bone._ascaleX(), scaleY = bone._ascaleY();
 		if (mixScaleX != 0 && scaleX != 0)
-			scaleX = (scaleX + (target._ascaleX - scaleX + _data._offsetScaleX) * mixScaleX) / scaleX;
+			scaleX = (scaleX + (target._ascaleX() - scaleX + _data._offsetScaleX) * mixScaleX) / scaleX;
 		if (mixScaleY != 0 && scaleY != 0)
-			scaleY = (scaleY + (target._ascaleY - scaleY + _data._offsetScaleY) * mixScaleY) / scaleY;
+			scaleY = (scaleY + (target._ascaleY() - scaleY + _data._offsetScaleY) * mixScaleY) / scaleY;
 
-		float shearY = bone._ashearY;
+		float shearY = bone._ashearY();
 		if (mixShearY != 0) {
-			float r = target._ashearY - shearY + _data._offsetShearY;
+			float r = target._ashearY() - shearY + _data._offsetShearY;
 			r -= (16384 - (int) (16384.499999999996 - r / 360)) * 360;
-			bone._shearY += r * mixShearY;
+			bone._shearY() += r * mixShearY;
 		}
 
-		bone.updateWorldTransform(x, y, rotation, scaleX, scaleY, bone._ashearX, shearY);
+		bone.updateWorldTransform(x, y, rotation, scaleX, scaleY, bone._ashearX(), shearY);
 	}
 }
 
@@ -320,14 +319,14 @@ void TransformConstraint::applyRelativeLocal() {
 		Bone *item = _bones[i];
 		Bone &bone = *item;
 
-		float rotation = bone._arotation + (target._arotation + _data._offsetRotation) * mixRotate;
-		float x = bone._ax + (target._ax + _data._offsetX) * mixX;
-		float y = bone._ay + (target._ay + _data._offsetY) * mixY;
-		float scaleX = bone._ascaleX * (((target._ascaleX - 1 + _data._offsetScaleX) * mixScaleX) + 1);
-		float scaleY = bone._ascaleY * (((target._ascaleY - 1 + _data._offsetScaleY) * mixScaleY) + 1);
-		float shearY = bone._ashearY + (target._ashearY + _data._offsetShearY) * mixShearY;
+		float rotation = bone._arotation() + (target._arotation() + _data._offsetRotation) * mixRotate;
+		float x = bone._ax() + (target._ax() + _data._offsetX) * mixX;
+		float y = bone._ay() + (target._ay() + _data._offsetY) * mixY;
+		float scaleX = bone._ascaleX() * (((target._ascaleX() - 1 + _data._offsetScaleX) * mixScaleX) + 1);
+		float scaleY = bone._ascaleY() * (((target._ascaleY() - 1 + _data._offsetScaleY) * mixScaleY) + 1);
+		float shearY = bone._ashearY() + (target._ashearY() + _data._offsetShearY) * mixShearY;
 
-		bone.updateWorldTransform(x, y, rotation, scaleX, scaleY, bone._ashearX, shearY);
+		bone.updateWorldTransform(x, y, rotation, scaleX, scaleY, bone._ashearX(), shearY);
 	}
 }
 
@@ -53,7 +53,7 @@ TranslateTimeline::~TranslateTimeline() {
 }
 
 void TranslateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-							  MixBlend blend, MixDirection direction) {
+							  MixBlend blend, MixDirection direction, int *searchCursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -64,12 +64,12 @@ void TranslateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Ve
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_x = bone->_data._x;
-				bone->_y = bone->_data._y;
+				bone->_x() = bone->_data._x;
+				bone->_y() = bone->_data._y;
 				return;
 			case MixBlend_First:
-				bone->_x += (bone->_data._x - bone->_x) * alpha;
-				bone->_y += (bone->_data._y - bone->_y) * alpha;
+				bone->_x() += (bone->_data._x - bone->_x()) * alpha;
+				bone->_y() += (bone->_data._y - bone->_y()) * alpha;
 			default: {
 			}
 		}
@@ -77,7 +77,7 @@ void TranslateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Ve
 	}
 
 	float x = 0, y = 0;
-	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES);
+	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES, searchCursor);
 	int curveType = (int) _curves[i / CurveTimeline2::ENTRIES];
 	switch (curveType) {
 		case CurveTimeline::LINEAR: {
@@ -103,17 +103,17 @@ void TranslateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Ve
 
 	switch (blend) {
 		case MixBlend_Setup:
-			bone->_x = bone->_data._x + x * alpha;
-			bone->_y = bone->_data._y + y * alpha;
+			bone->_x() = bone->_data._x + x * alpha;
+			bone->_y() = bone->_data._y + y * alpha;
 			break;
 		case MixBlend_First:
 		case MixBlend_Replace:
-			bone->_x += (bone->_data._x + x - bone->_x) * alpha;
-			bone->_y += (bone->_data._y + y - bone->_y) * alpha;
+			bone->_x() += (bone->_data._x + x - bone->_x()) * alpha;
+			bone->_y() += (bone->_data._y + y - bone->_y()) * alpha;
 			break;
 		case MixBlend_Add:
-			bone->_x += x * alpha;
-			bone->_y += y * alpha;
+			bone->_x() += x * alpha;
+			bone->_y() += y * alpha;
 	}
 }
 
@@ -130,7 +130,7 @@ TranslateXTimeline::~TranslateXTimeline() {
 }
 
 void TranslateXTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-							   MixBlend blend, MixDirection direction) {
+							   MixBlend blend, MixDirection direction, int *searchCursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -141,27 +141,27 @@ void TranslateXTimeline::apply(Skeleton &skeleton, float lastTime, float time, V
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_x = bone->_data._x;
+				bone->_x() = bone->_data._x;
 				return;
 			case MixBlend_First:
-				bone->_x += (bone->_data._x - bone->_x) * alpha;
+				bone->_x() += (bone->_data._x - bone->_x()) * alpha;
 			default: {
 			}
 		}
 		return;
 	}
 
-	float x = getCurveValue(time);
+	float x = getCurveValue(time, searchCursor);
 	switch (blend) {
 		case MixBlend_Setup:
-			bone->_x = bone->_data._x + x * alpha;
+			bone->_x() = bone->_data._x + x * alpha;
 			break;
 		case MixBlend_First:
 		case MixBlend_Replace:
-			bone->_x += (bone->_data._x + x - bone->_x) * alpha;
+			bone->_x() += (bone->_data._x + x - bone->_x()) * alpha;
 			break;
 		case MixBlend_Add:
-			bone->_x += x * alpha;
+			bone->_x() += x * alpha;
 	}
 }
 
@@ -178,7 +178,7 @@ TranslateYTimeline::~TranslateYTimeline() {
 }
 
 void TranslateYTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
-							   MixBlend blend, MixDirection direction) {
+							   MixBlend blend, MixDirection direction, int *searchCursor) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
 	SP_UNUSED(direction);
@@ -189,26 +189,26 @@ void TranslateYTimeline::apply(Skeleton &skeleton, float lastTime, float time, V
 	if (time < _frames[0]) {
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_y = bone->_data._y;
+				bone->_y() = bone->_data._y;
 				return;
 			case MixBlend_First:
-				bone->_y += (bone->_data._y - bone->_y) * alpha;
+				bone->_y() += (bone->_data._y - bone->_y()) * alpha;
 			default: {
 			}
 		}
 		return;
 	}
 
-	float y = getCurveValue(time);
+	float y = getCurveValue(time, searchCursor);
 	switch (blend) {
 		case MixBlend_Setup:
-			bone->_y = bone->_data._y + y * alpha;
+			bone->_y() = bone->_data._y + y * alpha;
 			break;
 		case MixBlend_First:
 		case MixBlend_Replace:
-			bone->_y += (bone->_data._y + y - bone->_y) * alpha;
+			bone->_y() += (bone->_data._y + y - bone->_y()) * alpha;
 			break;
 		case MixBlend_Add:
-			bone->_y += y * alpha;
+			bone->_y() += y * alpha;
 	}
 }
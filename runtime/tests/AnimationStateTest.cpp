@@ -0,0 +1,371 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "TestUtil.h"
+
+#include <atomic>
+#include <stdlib.h>
+#include <thread>
+
+using namespace spine;
+
+namespace {
+	int eventCounts[2];
+
+	void countEvents(AnimationState *state, EventType type, TrackEntry *entry, Event *event) {
+		SP_UNUSED(state);
+		SP_UNUSED(entry);
+		if (type == EventType_Event) eventCounts[event->getData().getName() == "hit" ? 1 : 0]++;
+	}
+
+	/// Queues idle, then run and attack, each mixing from the previous one.
+	void queueTransitions(AnimationState &state) {
+		state.setAnimation(0, "idle", true);
+		state.addAnimation(0, "run", true, 0.5f)->setMixDuration(0.2f);
+		state.addAnimation(0, "attack", false, 1.1f)->setMixDuration(0.25f);
+		state.addAnimation(1, "run", true, 0.3f)->setAlpha(0.5f);
+	}
+
+	void checkSamePose(Skeleton &a, Skeleton &b) {
+		for (size_t i = 0, n = a.getBones().size(); i < n; i++) {
+			Bone *boneA = a.getBones()[i], *boneB = b.getBones()[i];
+			SPINE_CHECK_NEAR(boneA->getRotation(), boneB->getRotation(), 5e-3f);
+			SPINE_CHECK_NEAR(boneA->getX(), boneB->getX(), 5e-3f);
+			SPINE_CHECK_NEAR(boneA->getY(), boneB->getY(), 5e-3f);
+			SPINE_CHECK_NEAR(boneA->getScaleX(), boneB->getScaleX(), 1e-4f);
+			SPINE_CHECK_NEAR(boneA->getShearX(), boneB->getShearX(), 5e-3f);
+		}
+		for (size_t i = 0, n = a.getSlots().size(); i < n; i++) {
+			SPINE_CHECK_NEAR(a.getSlots()[i]->getColor().r, b.getSlots()[i]->getColor().r, 1e-4f);
+		}
+	}
+
+	/// fastForward() to a time after queued transitions must match updating to the same time in small steps. The skeletons
+	/// are reset to the setup pose before each apply, since the track 1 entry would otherwise blend with the last pose.
+	void testFastForwardMatchesStepping(SkeletonData *skeletonData, float time, bool fireEvents) {
+		AnimationStateData stateData(skeletonData);
+		stateData.setDefaultMix(0.2f);
+
+		Skeleton stepped(skeletonData), forwarded(skeletonData);
+		AnimationState steppedState(&stateData), forwardedState(&stateData);
+		steppedState.setListener(countEvents);
+		forwardedState.setListener(countEvents);
+		queueTransitions(steppedState);
+		queueTransitions(forwardedState);
+
+		eventCounts[0] = eventCounts[1] = 0;
+		const float step = 1 / 240.0f;
+		int steps = (int) (time / step + 0.5f);
+		for (int i = 0; i < steps; i++) {
+			steppedState.update(step);
+			stepped.setToSetupPose();
+			steppedState.apply(stepped);
+		}
+		int steppedEvents[2] = {eventCounts[0], eventCounts[1]};
+
+		eventCounts[0] = eventCounts[1] = 0;
+		forwardedState.fastForward(steps * step, fireEvents);
+		forwarded.setToSetupPose();
+		forwardedState.apply(forwarded);
+
+		for (size_t i = 0; i < 2; i++) {
+			TrackEntry *a = steppedState.getCurrent(i), *b = forwardedState.getCurrent(i);
+			SPINE_CHECK(a != NULL && b != NULL);
+			if (a == NULL || b == NULL) continue;
+			SPINE_CHECK(a->getAnimation() == b->getAnimation());
+			SPINE_CHECK(b->getMixingFrom() == NULL);
+			SPINE_CHECK_NEAR(a->getTrackTime(), b->getTrackTime(), 1e-4f);
+		}
+		checkSamePose(stepped, forwarded);
+
+		if (fireEvents) {
+			SPINE_CHECK(eventCounts[0] == steppedEvents[0]);
+			SPINE_CHECK(eventCounts[1] == steppedEvents[1]);
+		} else {
+			SPINE_CHECK(eventCounts[0] == 0 && eventCounts[1] == 0);
+		}
+
+		// Both continue the same way.
+		steppedState.update(0.05f);
+		stepped.setToSetupPose();
+		steppedState.apply(stepped);
+		forwardedState.update(0.05f);
+		forwarded.setToSetupPose();
+		forwardedState.apply(forwarded);
+		checkSamePose(stepped, forwarded);
+	}
+
+	void testSeek(SkeletonData *skeletonData) {
+		AnimationStateData stateData(skeletonData);
+		AnimationState state(&stateData);
+		Skeleton skeleton(skeletonData), expected(skeletonData);
+		TrackEntry *entry = state.setAnimation(0, "run", true);
+		SPINE_CHECK(state.seek(0, 1.3f, false) == entry);
+		SPINE_CHECK_NEAR(entry->getTrackTime(), 1.3f, 0);
+		state.apply(skeleton);
+		skeletonData->findAnimation("run")->apply(expected, 0, 1.3f, true, NULL, 1, MixBlend_Setup, MixDirection_In);
+		checkSamePose(skeleton, expected);
+		SPINE_CHECK(state.seek(3, 1, false) == NULL);
+	}
+
+	/// Seeking while mixing completes the mix, including one interrupted by another mix, and poses as if the entry had been
+	/// set without a mix.
+	void testSeekWhileMixing(SkeletonData *skeletonData) {
+		AnimationStateData stateData(skeletonData);
+		AnimationState state(&stateData), expectedState(&stateData);
+		Skeleton skeleton(skeletonData), expected(skeletonData);
+		state.setAnimation(0, "idle", true);
+		state.update(0.1f);
+		state.apply(skeleton);
+		state.setAnimation(0, "run", true)->setMixDuration(0.4f);
+		state.update(0.1f);
+		state.apply(skeleton);
+		TrackEntry *entry = state.setAnimation(0, "attack", false);
+		entry->setMixDuration(0.4f);
+		state.update(0.1f);
+		state.apply(skeleton);
+
+		SPINE_CHECK(state.seek(0, 0.5f, false) == entry);
+		SPINE_CHECK(entry->getMixingFrom() == NULL);
+		SPINE_CHECK(entry->getMixTime() >= entry->getMixDuration());
+		expectedState.setAnimation(0, "attack", false);
+		expectedState.seek(0, 0.5f, false);
+		for (int i = 0; i < 5; i++) {
+			if (i == 2) {
+				state.setAnimation(0, "idle", true)->setMixDuration(0.2f);
+				expectedState.setAnimation(0, "idle", true)->setMixDuration(0.2f);
+			}
+			skeleton.setToSetupPose();
+			expected.setToSetupPose();
+			state.apply(skeleton);
+			expectedState.apply(expected);
+			checkSamePose(skeleton, expected);
+			state.update(0.1f);
+			expectedState.update(0.1f);
+		}
+	}
+
+	Animation *replacement;
+
+	void replaceOnComplete(AnimationState *state, EventType type, TrackEntry *entry, Event *event) {
+		SP_UNUSED(event);
+		if (type == EventType_Complete) state->setAnimation(entry->getTrackIndex(), replacement, false);
+	}
+
+	/// A listener replacing the entry while fast forwarding ends the fast forward of the track, the new entry starts at 0.
+	void testFastForwardReplaced(SkeletonData *skeletonData) {
+		AnimationStateData stateData(skeletonData);
+		AnimationState state(&stateData);
+		replacement = skeletonData->findAnimation("idle");
+		TrackEntry *entry = state.setAnimation(0, "attack", false);
+		entry->setListener(replaceOnComplete);
+		state.addAnimation(0, "run", true, 0);
+		state.fastForward(entry->getAnimationEnd() + 1, true);
+		TrackEntry *current = state.getCurrent(0);
+		SPINE_CHECK(current != NULL && current->getAnimation() == replacement);
+		SPINE_CHECK(current != NULL && current->getTrackTime() == 0);
+	}
+
+	/// Creates an animation rotating the bones from the first bone, in the specified memory.
+	Animation *createAnimation(void *memory, int timelineCount, int firstBone = 1) {
+		Vector<Timeline *> timelines;
+		for (int i = 0; i < timelineCount; i++) {
+			RotateTimeline *timeline = new (__FILE__, __LINE__) RotateTimeline(2, 0, firstBone + i);
+			timeline->setFrame(0, 0, 0);
+			timeline->setFrame(1, 1, 10.0f * (i + 1));
+			timelines.add(timeline);
+		}
+		return new (memory) Animation("reused", timelines, 1);
+	}
+
+	/// Timeline modes memoized for a deleted animation must not be used for another animation created at its address.
+	void testReusedAnimationAddress(SkeletonData *skeletonData) {
+		AnimationStateData stateData(skeletonData);
+		AnimationState state(&stateData);
+		Skeleton skeleton(skeletonData), expected(skeletonData);
+		void *memory = SpineExtension::alloc<char>(sizeof(Animation), __FILE__, __LINE__);
+
+		Animation *animation = createAnimation(memory, 1);
+		state.setAnimation(0, animation, false);
+		state.apply(skeleton);
+		state.clearTracks();
+		animation->~Animation();
+
+		animation = createAnimation(memory, 4);
+		state.setAnimation(0, animation, false);
+		state.update(0.5f);
+		skeleton.setToSetupPose();
+		state.apply(skeleton);
+		animation->apply(expected, 0, 0.5f, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+		checkSamePose(skeleton, expected);
+
+		state.clearTracks();
+		animation->~Animation();
+
+		// With the same number of timelines but other bones, the modes differ when a lower track keys the first bone.
+		void *lowerMemory = SpineExtension::alloc<char>(sizeof(Animation), __FILE__, __LINE__);
+		Animation *lower = createAnimation(lowerMemory, 1);
+		animation = createAnimation(memory, 1, 1);
+		state.setAnimation(0, lower, false);
+		state.setAnimation(1, animation, false)->setAlpha(0.5f);
+		state.apply(skeleton);
+		state.clearTracks();
+		animation->~Animation();
+
+		animation = createAnimation(memory, 1, 2);
+		AnimationStateData expectedData(skeletonData);
+		AnimationState expectedState(&expectedData);
+		AnimationState *states[] = {&state, &expectedState};
+		Skeleton *skeletons[] = {&skeleton, &expected};
+		for (int i = 0; i < 2; i++) {
+			states[i]->setAnimation(0, lower, false);
+			states[i]->setAnimation(1, animation, false)->setAlpha(0.5f);
+			states[i]->update(0.5f);
+			skeletons[i]->setToSetupPose();
+			skeletons[i]->getBones()[2]->setRotation(45);
+			states[i]->apply(*skeletons[i]);
+		}
+		checkSamePose(skeleton, expected);
+
+		state.clearTracks();
+		expectedState.clearTracks();
+		animation->~Animation();
+		lower->~Animation();
+		SpineExtension::free(lowerMemory, __FILE__, __LINE__);
+		SpineExtension::free(memory, __FILE__, __LINE__);
+	}
+
+	/// An animation created at runtime is indexed when first applied, which states applied on several threads may do at
+	/// the same time.
+	void testIndexPropertiesOnThreads(SkeletonData *skeletonData) {
+		void *memory = SpineExtension::alloc<char>(sizeof(Animation), __FILE__, __LINE__);
+		Animation *animation = createAnimation(memory, 4);
+		Skeleton expected(skeletonData);
+		animation->apply(expected, 0, 0.5f, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+		AnimationStateData stateData(skeletonData);
+		// Without memoized timeline modes, each state indexes the properties.
+		stateData.setTimelineModeCacheSize(0);
+
+		const int threadCount = 4;
+		bool passed[threadCount];
+		std::thread threads[threadCount];
+		std::atomic<int> waiting(threadCount);
+		for (int t = 0; t < threadCount; t++) {
+			passed[t] = true;
+			threads[t] = std::thread([&, t]() {
+				AnimationState state(&stateData);
+				Skeleton skeleton(skeletonData);
+				state.setAnimation(0, "idle", false);
+				state.update(0.2f);
+				state.apply(skeleton);
+				// Start applying the animation together.
+				waiting--;
+				while (waiting > 0) std::this_thread::yield();
+				state.setAnimation(0, animation, false)->setMixDuration(0.1f);
+				state.update(0.5f);
+				state.apply(skeleton);
+				for (size_t i = 1; i <= 4; i++) {
+					float difference = skeleton.getBones()[i]->getRotation() - expected.getBones()[i]->getRotation();
+					if (difference > 1e-4f || difference < -1e-4f) passed[t] = false;
+				}
+			});
+		}
+		for (int t = 0; t < threadCount; t++) {
+			threads[t].join();
+			SPINE_CHECK(passed[t]);
+		}
+
+		animation->~Animation();
+		SpineExtension::free(memory, __FILE__, __LINE__);
+	}
+
+	/// The empty animation is shared by all skeleton data, so states of different skeleton data mixing to it on several
+	/// threads must not index it.
+	void testEmptyAnimationOnThreads() {
+		const char *files[] = {"skeleton.json", "constraints.json"};
+		std::thread threads[2];
+		for (int t = 0; t < 2; t++) {
+			threads[t] = std::thread([&files, t]() {
+				SkeletonData *skeletonData = TestUtil::readSkeletonData(files[t]);
+				AnimationStateData stateData(skeletonData);
+				stateData.setTimelineModeCacheSize(0);
+				AnimationState state(&stateData);
+				Skeleton skeleton(skeletonData);
+				for (int i = 0; i < 100; i++) {
+					state.setAnimation(0, skeletonData->getAnimations()[0], false);
+					state.setEmptyAnimation(0, 0.1f);
+					state.update(0.05f);
+					state.apply(skeleton);
+				}
+				state.clearTracks();
+				delete skeletonData;
+			});
+		}
+		for (int t = 0; t < 2; t++)
+			threads[t].join();
+	}
+
+	/// A search cursor gives the same frames as a binary search, forward, backward and at random, and afterwards holds the
+	/// frame found. A cursor past the frames, as left by a longer timeline, is ignored.
+	void testSearchCursor() {
+		const int step = 3, frameCount = 50;
+		Vector<float> frames;
+		for (int i = 0; i < frameCount; i++) {
+			frames.add(i * 0.1f + (i > 20 && i < 25 ? 0.05f : 0));
+			frames.add(0);
+			frames.add(0);
+		}
+		int cursor = 1000;
+		srand(13);
+		for (int i = 0; i < 1000; i++) {
+			float time = i < 400 ? i * 0.0125f : i < 800 ? (800 - i) * 0.0125f : (float) (rand() % 5000) / 1000;
+			int frame = Animation::search(frames, time, step, &cursor);
+			SPINE_CHECK(frame == Animation::search(frames, time, step));
+			SPINE_CHECK(cursor == frame);
+		}
+	}
+}
+
+int main() {
+	SkeletonData *skeletonData = TestUtil::readSkeletonData("skeleton.json");
+	// Before the run mix ends, on run, after attack starts, and after the attack mix ends.
+	testFastForwardMatchesStepping(skeletonData, 0.4f, true);
+	testFastForwardMatchesStepping(skeletonData, 1.0f, true);
+	testFastForwardMatchesStepping(skeletonData, 1.95f, false);
+	testFastForwardMatchesStepping(skeletonData, 2.5f, true);
+	testSeek(skeletonData);
+	testSeekWhileMixing(skeletonData);
+	testFastForwardReplaced(skeletonData);
+	testReusedAnimationAddress(skeletonData);
+	testIndexPropertiesOnThreads(skeletonData);
+	delete skeletonData;
+	testEmptyAnimationOnThreads();
+	testSearchCursor();
+	return TestUtil::finish("AnimationStateTest");
+}
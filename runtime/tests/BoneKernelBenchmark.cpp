@@ -0,0 +1,142 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "TestUtil.h"
+
+using namespace spine;
+
+// Measures BoneKernel on skeletons of 200 to 1000 TransformMode_Normal bones of different shapes. Compares
+// Skeleton::updateWorldTransform(), which runs the bones through BoneKernel::updateNormal(), with updating each bone on its
+// own through the update cache, and SkeletonInstanceBatch, which uses BoneKernel::updateNormalInstances(), with updating
+// the same instances one by one.
+namespace {
+	struct Shape {
+		int chainCount, chainLength;
+	};
+
+	/// The skeletons have no constraints, so the update cache holds only bones.
+	void updateBones(Skeleton &skeleton) {
+		Vector<Updatable *> &updateCache = skeleton.getUpdateCacheList();
+		for (size_t i = 0, n = updateCache.size(); i < n; i++)
+			static_cast<Bone *>(updateCache[i])->updateWorldTransform();
+	}
+
+	void updateKernel(Skeleton &skeleton) {
+		skeleton.updateWorldTransform();
+	}
+
+	/// @return Microseconds per update.
+	double timeUpdates(Skeleton &skeleton, void (*update)(Skeleton &)) {
+		int count = 1;
+		for (;;) {
+			double start = TestUtil::seconds();
+			for (int i = 0; i < count; i++)
+				update(skeleton);
+			double elapsed = TestUtil::seconds() - start;
+			if (elapsed > 0.2) return elapsed * 1e6 / count;
+			count *= 2;
+		}
+	}
+
+	/// @return Microseconds per update of all skeletons.
+	double timeInstances(Vector<Skeleton *> &skeletons, SkeletonInstanceBatch *batch) {
+		int count = 1;
+		for (;;) {
+			double start = TestUtil::seconds();
+			for (int i = 0; i < count; i++) {
+				if (batch)
+					batch->updateWorldTransform(skeletons);
+				else {
+					for (size_t ii = 0, n = skeletons.size(); ii < n; ii++)
+						skeletons[ii]->updateWorldTransform();
+				}
+			}
+			double elapsed = TestUtil::seconds() - start;
+			if (elapsed > 0.2) return elapsed * 1e6 / count;
+			count *= 2;
+		}
+	}
+
+	float maxDifference(Skeleton &a, Skeleton &b) {
+		float result = 0;
+		for (size_t i = 0, n = a.getBones().size(); i < n; i++) {
+			Bone *boneA = a.getBones()[i], *boneB = b.getBones()[i];
+			float d[] = {boneA->getA() - boneB->getA(), boneA->getB() - boneB->getB(), boneA->getC() - boneB->getC(),
+						 boneA->getD() - boneB->getD(), boneA->getWorldX() - boneB->getWorldX(),
+						 boneA->getWorldY() - boneB->getWorldY()};
+			for (int ii = 0; ii < 6; ii++)
+				result = MathUtil::max(result, MathUtil::abs(d[ii]));
+		}
+		return result;
+	}
+}
+
+int main() {
+	const Shape shapes[] = {{4, 50}, {25, 8}, {50, 4}, {16, 32}, {64, 16}};
+	const int shapeCount = sizeof(shapes) / sizeof(shapes[0]), instanceCount = 64;
+	const TrigMode modes[] = {TrigMode_Exact, TrigMode_Polynomial};
+	const char *modeNames[] = {"exact", "polynomial"};
+
+	for (int m = 0; m < 2; m++) {
+		MathUtil::setTrigMode(modes[m]);
+		printf("TrigMode %s\n", modeNames[m]);
+		printf("  bones  chains  per bone us  kernel us  speedup  max difference  %d instances us  batch us  speedup\n",
+			   instanceCount);
+		for (int s = 0; s < shapeCount; s++) {
+			const Shape &shape = shapes[s];
+			SkeletonData *skeletonData = TestUtil::createSkeletonData(shape.chainCount, shape.chainLength);
+			Animation *animation = skeletonData->findAnimation("wave");
+
+			Vector<Skeleton *> skeletons;
+			for (int i = 0; i < instanceCount; i++) {
+				Skeleton *skeleton = new (__FILE__, __LINE__) Skeleton(skeletonData);
+				animation->apply(*skeleton, 0, 0.3f + i * 0.01f, true, NULL, 1, MixBlend_Setup, MixDirection_In);
+				skeletons.add(skeleton);
+			}
+			Skeleton &bones = *skeletons[0], &kernel = *skeletons[1];
+			animation->apply(kernel, 0, 0.3f, true, NULL, 1, MixBlend_Setup, MixDirection_In);
+
+			double boneTime = timeUpdates(bones, updateBones), kernelTime = timeUpdates(kernel, updateKernel);
+			float difference = maxDifference(bones, kernel);
+
+			SkeletonInstanceBatch batch;
+			double singleTime = timeInstances(skeletons, NULL), batchTime = timeInstances(skeletons, &batch);
+
+			printf("  %5d  %6d  %11.2f  %9.2f  %7.2f  %14.2g  %15.1f  %8.1f  %7.2f\n",
+				   (int) skeletonData->getBones().size(), shape.chainCount, boneTime, kernelTime, boneTime / kernelTime,
+				   difference, singleTime, batchTime, singleTime / batchTime);
+
+			for (int i = 0; i < instanceCount; i++)
+				delete skeletons[i];
+			delete skeletonData;
+		}
+		printf("\n");
+	}
+	return 0;
+}
@@ -0,0 +1,130 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "TestUtil.h"
+
+#include <stdlib.h>
+
+using namespace spine;
+
+// Measures the load time cost of building the bezier tables, the speed of evaluating curves and the memory of the curve
+// timelines before and after quantizing them. Pass the path of a skeleton JSON file to measure its curves, else the test
+// skeleton is used.
+namespace {
+	float random(float min, float max) {
+		return min + (max - min) * (float) rand() / RAND_MAX;
+	}
+
+	void benchmarkSetBezier() {
+		const int count = 100000;
+		RotateTimeline timeline(2, 1, 0);
+		srand(7);
+		Vector<float> curves;
+		for (int i = 0; i < count * 4; i++)
+			curves.add(random(0, 1));
+		double start = TestUtil::seconds();
+		for (int i = 0; i < count; i++) {
+			const float *c = &curves[i * 4];
+			timeline.setBezier(0, 0, 0, 0, 0, c[0], c[1] * 90, c[2], c[3] * 90, 1, 90);
+		}
+		printf("setBezier(): %.3f us per bezier\n", (TestUtil::seconds() - start) * 1e6 / count);
+	}
+
+	void benchmarkSkeleton(const char *path) {
+		SkeletonJson json((Atlas *) NULL);
+		double start = TestUtil::seconds();
+		SkeletonData *skeletonData = path ? json.readSkeletonDataFile(path) : TestUtil::readSkeletonData("skeleton.json");
+		double loadTime = TestUtil::seconds() - start;
+		if (!skeletonData) {
+			printf("Unable to read %s: %s\n", path, json.getError().buffer());
+			return;
+		}
+
+		// A bezier frame's curve type is 2 plus the index of the table of its first value. Each value has a table of 18
+		// floats starting with the segment count, which is negative for curves computed exactly.
+		Vector<CurveTimeline *> curveTimelines;
+		Vector<CurveTimeline1 *> timelines;
+		size_t beziers = 0, exact = 0, byteCount = 0;
+		for (size_t i = 0, n = skeletonData->getAnimations().size(); i < n; i++) {
+			Vector<Timeline *> &animationTimelines = skeletonData->getAnimations()[i]->getTimelines();
+			for (size_t ii = 0; ii < animationTimelines.size(); ii++) {
+				Timeline *timeline = animationTimelines[ii];
+				if (!timeline->getRTTI().instanceOf(CurveTimeline::rtti)) continue;
+				CurveTimeline *curveTimeline = static_cast<CurveTimeline *>(timeline);
+				Vector<float> &curves = curveTimeline->getCurves();
+				curveTimelines.add(curveTimeline);
+				byteCount += curveTimeline->getByteCount();
+				if (timeline->getRTTI().instanceOf(CurveTimeline1::rtti))
+					timelines.add(static_cast<CurveTimeline1 *>(timeline));
+				if (curveTimeline->isQuantized()) continue;
+				for (size_t frame = 0; frame + 1 < timeline->getFrameCount(); frame++) {
+					if (curves[frame] < 2) continue;
+					for (size_t value = 0; value + 1 < timeline->getFrameEntries(); value++) {
+						size_t table = (size_t) curves[frame] - 2 + value * 18;
+						if (table >= curves.size()) break;
+						beziers++;
+						if (curves[table] < 0) exact++;
+					}
+				}
+			}
+		}
+		printf("%s: loaded in %.1f ms, %d beziers, %d computed exactly\n", path ? path : "skeleton.json", loadTime * 1e3,
+			   (int) beziers, (int) exact);
+
+		const int count = 10000000;
+		Vector<float> times;
+		Vector<int> indices;
+		srand(7);
+		for (int i = 0; i < 4096; i++) {
+			indices.add(rand() % (int) timelines.size());
+			Vector<float> &frames = timelines[indices[i]]->getFrames();
+			times.add(random(frames[0], frames[frames.size() - 2]));
+		}
+		float sum = 0;
+		start = TestUtil::seconds();
+		for (int i = 0; i < count; i++)
+			sum += timelines[indices[i & 4095]]->getCurveValue(times[i & 4095]);
+		printf("%d CurveTimeline1 evaluations: %.1f ms (%g)\n", count, (TestUtil::seconds() - start) * 1e3, sum);
+
+		size_t quantizedCount = 0;
+		for (size_t i = 0; i < curveTimelines.size(); i++) {
+			curveTimelines[i]->quantize();
+			quantizedCount += curveTimelines[i]->getByteCount();
+		}
+		printf("%d curve timelines: %d KB, %d KB quantized\n", (int) curveTimelines.size(), (int) (byteCount / 1024),
+			   (int) (quantizedCount / 1024));
+		delete skeletonData;
+	}
+}
+
+int main(int argc, char **argv) {
+	benchmarkSetBezier();
+	benchmarkSkeleton(argc > 1 ? argv[1] : NULL);
+	return 0;
+}
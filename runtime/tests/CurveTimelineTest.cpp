@@ -0,0 +1,277 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "TestUtil.h"
+
+#include <algorithm>
+#include <math.h>
+#include <stdlib.h>
+
+using namespace spine;
+
+namespace {
+	/// The evaluator CurveTimeline used before the uniform time tables: 10 forward differenced points of the curve, with
+	/// the value at the time interpolated linearly between the points around it.
+	float oldBezierValue(float time, float time1, float value1, float cx1, float cy1, float cx2, float cy2, float time2,
+						 float value2) {
+		float tmpx = (time1 - cx1 * 2 + cx2) * 0.03, tmpy = (value1 - cy1 * 2 + cy2) * 0.03;
+		float dddx = ((cx1 - cx2) * 3 - time1 + time2) * 0.006, dddy = ((cy1 - cy2) * 3 - value1 + value2) * 0.006;
+		float ddx = tmpx * 2 + dddx, ddy = tmpy * 2 + dddy;
+		float dx = (cx1 - time1) * 0.3 + tmpx + dddx * 0.16666667, dy = (cy1 - value1) * 0.3 + tmpy + dddy * 0.16666667;
+		float x = time1 + dx, y = value1 + dy;
+		if (x > time) return value1 + (time - time1) / (x - time1) * (y - value1);
+		for (int i = 1; i < 9; i++) {
+			float px = x, py = y;
+			dx += ddx;
+			dy += ddy;
+			ddx += dddx;
+			ddy += dddy;
+			x += dx;
+			y += dy;
+			if (x >= time) return py + (time - px) / (x - px) * (y - py);
+		}
+		return y + (time - x) / (time2 - x) * (value2 - y);
+	}
+
+	/// The value of the cubic at the time, finding its parameter by bisection in double precision.
+	double exactBezierValue(double time, double time1, double value1, double cx1, double cy1, double cx2, double cy2,
+							double time2, double value2) {
+		double low = 0, high = 1;
+		for (int i = 0; i < 60; i++) {
+			double t = (low + high) / 2, u = 1 - t;
+			if (u * u * u * time1 + 3 * u * u * t * cx1 + 3 * u * t * t * cx2 + t * t * t * time2 < time)
+				low = t;
+			else
+				high = t;
+		}
+		double t = (low + high) / 2, u = 1 - t;
+		return u * u * u * value1 + 3 * u * u * t * cy1 + 3 * u * t * t * cy2 + t * t * t * value2;
+	}
+
+	float random(float min, float max) {
+		return min + (max - min) * (float) rand() / RAND_MAX;
+	}
+
+	/// Checks the tables against the old evaluator and the exact cubic, with the tolerance as a fraction of the value range
+	/// of each curve. Where the old evaluator is off, the tables may differ from it by as much plus the tolerance.
+	/// @param editorCurves True to keep the control points within the key values and the control times ordered.
+	void checkBezierTables(bool editorCurves, float tolerance, float &maxOld, float &maxExact) {
+		srand(7);
+		for (int curve = 0; curve < 2000; curve++) {
+			// Control times stay within the key interval, as the editor keeps them.
+			float time1 = random(0, 2), time2 = time1 + random(0.01f, 2);
+			float cx1 = time1 + (time2 - time1) * random(0, 1), cx2 = time1 + (time2 - time1) * random(0, 1);
+			float value1 = random(-200, 200), value2 = random(-200, 200);
+			float cy1 = random(-300, 300), cy2 = random(-300, 300);
+			if (editorCurves) {
+				if (cx1 > cx2) std::swap(cx1, cx2);
+				cy1 = value1 + (value2 - value1) * random(0, 1);
+				cy2 = value1 + (value2 - value1) * random(0, 1);
+			}
+			float range = fmaxf(fmaxf(value1, value2), fmaxf(cy1, cy2)) - fminf(fminf(value1, value2), fminf(cy1, cy2));
+
+			RotateTimeline timeline(2, 1, 0);
+			timeline.setFrame(0, time1, value1);
+			timeline.setFrame(1, time2, value2);
+			timeline.setBezier(0, 0, 0, time1, value1, cx1, cy1, cx2, cy2, time2, value2);
+			for (int sample = 0; sample <= 100; sample++) {
+				float time = time1 + (time2 - time1) * sample / 100;
+				float value = timeline.getCurveValue(time);
+				float old = oldBezierValue(time, time1, value1, cx1, cy1, cx2, cy2, time2, value2);
+				float exact = (float) exactBezierValue(time, time1, value1, cx1, cy1, cx2, cy2, time2, value2);
+				SPINE_CHECK(fabsf(value - old) <= fabsf(old - exact) + tolerance * range);
+				SPINE_CHECK(fabsf(value - exact) <= tolerance * range);
+				maxOld = fmaxf(maxOld, fabsf(value - old) / range);
+				maxExact = fmaxf(maxExact, fabsf(value - exact) / range);
+			}
+		}
+	}
+
+	/// Validates the uniform time tables with a tolerance of 1.5% of each curve's value range, beyond the old evaluator's
+	/// own difference from the exact cubic. On exported skeletons the largest difference from the old evaluator is 1.33%
+	/// (29k beziers) and 0.36% (826 beziers). Curves the tables don't fit within CurveTimeline::MaxBezierTableError are
+	/// computed exactly, so sharp curves, which the old evaluator is up to 6% off for, stay within the tolerance of the
+	/// exact cubic.
+	void testBezierTables() {
+		const float tolerance = 0.015f;
+		float maxOld = 0, maxExact = 0;
+		checkBezierTables(true, tolerance, maxOld, maxExact);
+		printf("Editor curves, largest difference in %% of the value range: %.3f from the old evaluator, %.3f from the "
+			   "exact cubic.\n", maxOld * 100, maxExact * 100);
+		maxOld = maxExact = 0;
+		checkBezierTables(false, tolerance, maxOld, maxExact);
+		printf("Any curves, largest difference in %% of the value range: %.3f from the old evaluator, %.3f from the "
+			   "exact cubic.\n", maxOld * 100, maxExact * 100);
+	}
+
+	/// The curves of the test skeleton, as exported, evaluate within the tolerance of the old evaluator.
+	void testExportedCurves(SkeletonData *skeletonData) {
+		const float tolerance = 0.015f;
+		int curves = 0;
+		for (size_t i = 0, n = skeletonData->getAnimations().size(); i < n; i++) {
+			Vector<Timeline *> &timelines = skeletonData->getAnimations()[i]->getTimelines();
+			for (size_t ii = 0; ii < timelines.size(); ii++) {
+				if (!timelines[ii]->getRTTI().isExactly(RotateTimeline::rtti)) continue;
+				RotateTimeline &timeline = *static_cast<RotateTimeline *>(timelines[ii]);
+				Vector<float> &frames = timeline.getFrames(), &table = timeline.getCurves();
+				for (size_t frame = 0; frame + 1 < timeline.getFrameCount(); frame++) {
+					// A bezier frame's curve type is 2 plus the index of its table, which starts with the segment count
+					// and the control points.
+					if (table[frame] < 2) continue;
+					const float *controls = &table[(size_t) table[frame] - 2 + 1];
+					float time1 = frames[frame * 2], value1 = frames[frame * 2 + 1];
+					float time2 = frames[frame * 2 + 2], value2 = frames[frame * 2 + 3];
+					float range = fmaxf(fmaxf(value1, value2), fmaxf(controls[1], controls[3])) -
+								  fminf(fminf(value1, value2), fminf(controls[1], controls[3]));
+					// At the next key, the timeline uses the next frame.
+					for (int sample = 0; sample < 100; sample++) {
+						float time = time1 + (time2 - time1) * sample / 100;
+						SPINE_CHECK_NEAR(timeline.getCurveValue(time),
+										 oldBezierValue(time, time1, value1, controls[0], controls[1], controls[2],
+														controls[3], time2, value2), tolerance * range);
+					}
+					curves++;
+				}
+			}
+		}
+		SPINE_CHECK(curves > 0);
+	}
+
+	/// Sets frames that are linear with noise below the tolerance, then a few that move too far, then stepped frames
+	/// holding a value with the same noise, and a bezier frame.
+	void setRedundantFrames(CurveTimeline &timeline, int frameCount, float tolerance) {
+		srand(11);
+		int values = (int) timeline.getFrameEntries() - 1;
+		for (int frame = 0; frame < frameCount; frame++) {
+			float time = frame / 30.0f, v[2];
+			for (int i = 0; i < values; i++) {
+				float noise = random(-0.4f, 0.4f) * tolerance;
+				if (frame < frameCount / 2)
+					v[i] = frame * (i + 1.5f) + noise;
+				else if (frame < frameCount * 5 / 8)
+					v[i] = frame * frame * (i + 0.5f);
+				else
+					v[i] = 40 + noise;
+			}
+			if (values == 1)
+				static_cast<CurveTimeline1 &>(timeline).setFrame(frame, time, v[0]);
+			else
+				static_cast<CurveTimeline2 &>(timeline).setFrame(frame, time, v[0], v[1]);
+			if (frame >= frameCount * 5 / 8) timeline.setStepped(frame);
+		}
+		int frame = frameCount / 2 + 1;
+		Vector<float> &frames = timeline.getFrames();
+		for (int i = 0; i < values; i++) {
+			float time1 = frames[frame * (values + 1)], value1 = frames[frame * (values + 1) + 1 + i];
+			float time2 = frames[(frame + 1) * (values + 1)], value2 = frames[(frame + 1) * (values + 1) + 1 + i];
+			timeline.setBezier(i, frame, (float) i, time1, value1, time1 + 0.01f, value1 + 5, time2 - 0.01f, value2,
+							   time2, value2);
+		}
+	}
+
+	/// Removing redundant frames keeps the timeline within the tolerance of the original at and between every frame. Only
+	/// rotate, shear and translate timelines are changed, each with its own tolerance.
+	void testRemoveRedundantFrames() {
+		const int frameCount = 64;
+		const float rotateTolerance = 0.5f, translateTolerance = 2;
+		RotateTimeline rotate(frameCount, 1, 0), originalRotate(frameCount, 1, 0);
+		TranslateTimeline translate(frameCount, 2, 0), originalTranslate(frameCount, 2, 0);
+		ScaleTimeline scale(frameCount, 2, 0);
+		setRedundantFrames(rotate, frameCount, rotateTolerance);
+		setRedundantFrames(originalRotate, frameCount, rotateTolerance);
+		setRedundantFrames(translate, frameCount, translateTolerance);
+		setRedundantFrames(originalTranslate, frameCount, translateTolerance);
+		setRedundantFrames(scale, frameCount, translateTolerance);
+
+		Vector<Timeline *> timelines;
+		timelines.add(&rotate);
+		timelines.add(&translate);
+		timelines.add(&scale);
+		SPINE_CHECK(CurveTimeline::removeRedundantFrames(timelines, -1, -1) == 0);
+		size_t removed = CurveTimeline::removeRedundantFrames(timelines, rotateTolerance, translateTolerance);
+		SPINE_CHECK(removed == (frameCount - rotate.getFrameCount()) + (frameCount - translate.getFrameCount()));
+		SPINE_CHECK(rotate.getFrameCount() < frameCount / 2);
+		SPINE_CHECK(translate.getFrameCount() < frameCount / 2);
+		SPINE_CHECK(scale.getFrameCount() == frameCount);
+
+		Vector<float> &frames = originalRotate.getFrames();
+		for (int frame = 0; frame + 1 < frameCount; frame++) {
+			for (int sample = 0; sample < 4; sample++) {
+				float time = frames[frame * 2] + (frames[frame * 2 + 2] - frames[frame * 2]) * sample / 4;
+				SPINE_CHECK_NEAR(rotate.getCurveValue(time), originalRotate.getCurveValue(time), rotateTolerance);
+				float x, y, originalX, originalY;
+				translate.getCurveValues(time, x, y);
+				originalTranslate.getCurveValues(time, originalX, originalY);
+				SPINE_CHECK_NEAR(x, originalX, translateTolerance);
+				SPINE_CHECK_NEAR(y, originalY, translateTolerance);
+			}
+		}
+	}
+
+	/// The byte count covers the frames, curves and quantized curves, and shrinks to exactly those once quantized.
+	void testByteCount() {
+		const int frameCount = 5, bezierCount = 3;
+		TranslateTimeline timeline(frameCount, bezierCount * 2, 0);
+		for (int frame = 0; frame < frameCount; frame++)
+			timeline.setFrame(frame, frame * 0.5f, frame * 10.0f, frame * -5.0f);
+		for (int bezier = 0; bezier < bezierCount; bezier++) {
+			float time1 = bezier * 0.5f, time2 = time1 + 0.5f;
+			for (int value = 0; value < 2; value++)
+				timeline.setBezier(bezier * 2 + value, bezier, value, time1, 0, time1 + 0.1f, 3, time2 - 0.2f, 8, time2,
+								   10);
+		}
+		size_t frameBytes = frameCount * 3 * sizeof(float), typeBytes = frameCount * sizeof(float);
+		size_t byteCount = timeline.getByteCount();
+		SPINE_CHECK(byteCount >= frameBytes + typeBytes + bezierCount * 2 * 18 * sizeof(float));
+
+		timeline.quantize();
+		SPINE_CHECK(timeline.isQuantized());
+		SPINE_CHECK(timeline.getByteCount() == frameBytes + typeBytes + bezierCount * 2 * 4 * sizeof(unsigned short));
+		SPINE_CHECK(timeline.getByteCount() < byteCount);
+
+		// Deform timelines also count the vertex offsets of each frame.
+		MeshAttachment mesh("mesh");
+		DeformTimeline deform(2, 0, 0, &mesh);
+		size_t emptyCount = deform.getByteCount();
+		Vector<float> offsets;
+		offsets.setSize(100, 1);
+		deform.setFrame(0, 0, 4, offsets);
+		SPINE_CHECK(deform.getByteCount() >= emptyCount + 100 * sizeof(float));
+	}
+}
+
+int main() {
+	testBezierTables();
+	testByteCount();
+	testRemoveRedundantFrames();
+	SkeletonData *skeletonData = TestUtil::readSkeletonData("skeleton.json");
+	testExportedCurves(skeletonData);
+	delete skeletonData;
+	return TestUtil::finish("CurveTimelineTest");
+}
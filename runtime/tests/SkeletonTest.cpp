@@ -0,0 +1,231 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "TestUtil.h"
+
+#include <thread>
+
+using namespace spine;
+
+namespace {
+	const int SkinCount = 4;
+
+	/// Poses a skeleton with the skin: 0 for none, 1 the default skin, 2 armor, 3 a skin created at runtime.
+	void pose(Skeleton &skeleton, int skin, Skin *runtimeSkin) {
+		SkeletonData *data = skeleton.getData();
+		skeleton.setSkin(skin == 0 ? NULL : skin == 1 ? data->getDefaultSkin() : skin == 2 ? data->findSkin("armor") : runtimeSkin);
+		skeleton.setToSetupPose();
+		data->findAnimation("reach")->apply(skeleton, 0, 0.3f, true, NULL, 1, MixBlend_Setup, MixDirection_In);
+		skeleton.updateWorldTransform();
+	}
+
+	/// Inactive bones keep the world transform of when they were last active, only active bones are compared.
+	bool samePose(Skeleton &a, Skeleton &b) {
+		for (size_t i = 0, n = a.getBones().size(); i < n; i++) {
+			Bone *boneA = a.getBones()[i], *boneB = b.getBones()[i];
+			if (boneA->isActive() != boneB->isActive()) return false;
+			if (!boneA->isActive()) continue;
+			if (boneA->getWorldX() != boneB->getWorldX() ||
+				boneA->getWorldY() != boneB->getWorldY() || boneA->getA() != boneB->getA() ||
+				boneA->getB() != boneB->getB() || boneA->getC() != boneB->getC() || boneA->getD() != boneB->getD())
+				return false;
+		}
+		return true;
+	}
+
+	Skin *createRuntimeSkin(SkeletonData *data, bool withPlate) {
+		Skin *skin = new (__FILE__, __LINE__) Skin("runtime");
+		skin->getBones().add(data->findBone("shield"));
+		if (withPlate) skin->getBones().add(data->findBone("plate"));
+		return skin;
+	}
+
+	/// Skeletons switching skins must pose as they do without the update order cache, also when the cache evicts orders
+	/// and when a skin is deleted and another one is likely created at the same address.
+	void testUpdateOrderCache(SkeletonData *data) {
+		Skin *runtimeSkin = createRuntimeSkin(data, false);
+		data->setUpdateOrderCacheSize(0);
+		Skeleton *expected[SkinCount];
+		for (int i = 0; i < SkinCount; i++) {
+			expected[i] = new (__FILE__, __LINE__) Skeleton(data);
+			pose(*expected[i], i, runtimeSkin);
+		}
+
+		data->setUpdateOrderCacheSize(2);
+		SPINE_CHECK(data->getUpdateOrderCacheSize() == 2);
+		Skeleton a(data), b(data);
+		for (int i = 0; i < 40; i++) {
+			int skin = (i * 3) % SkinCount;
+			pose(a, skin, runtimeSkin);
+			SPINE_CHECK(samePose(a, *expected[skin]));
+			pose(b, (skin + 1) % SkinCount, runtimeSkin);
+			SPINE_CHECK(samePose(b, *expected[(skin + 1) % SkinCount]));
+		}
+
+		pose(a, 3, runtimeSkin);
+		a.setSkin((Skin *) NULL);
+		delete runtimeSkin;
+		runtimeSkin = createRuntimeSkin(data, true);
+		delete expected[3];
+		data->setUpdateOrderCacheSize(0);
+		expected[3] = new (__FILE__, __LINE__) Skeleton(data);
+		pose(*expected[3], 3, runtimeSkin);
+		data->setUpdateOrderCacheSize(2);
+		pose(a, 3, runtimeSkin);
+		SPINE_CHECK(samePose(a, *expected[3]));
+
+		for (int i = 0; i < SkinCount; i++)
+			delete expected[i];
+		delete runtimeSkin;
+	}
+
+	/// Skeletons created and posed on several threads share the update order cache of their data.
+	void testThreads(SkeletonData *data) {
+		data->setUpdateOrderCacheSize(0);
+		Skeleton *expected[3];
+		for (int i = 0; i < 3; i++) {
+			expected[i] = new (__FILE__, __LINE__) Skeleton(data);
+			pose(*expected[i], i, NULL);
+		}
+		data->setUpdateOrderCacheSize(2);
+
+		const int threadCount = 4;
+		bool passed[threadCount];
+		std::thread threads[threadCount];
+		for (int t = 0; t < threadCount; t++) {
+			passed[t] = true;
+			threads[t] = std::thread([data, &expected, &passed, t]() {
+				for (int i = 0; i < 200; i++) {
+					int skin = (i + t) % 3;
+					Skeleton skeleton(data);
+					pose(skeleton, skin, NULL);
+					if (!samePose(skeleton, *expected[skin])) passed[t] = false;
+				}
+			});
+		}
+		for (int t = 0; t < threadCount; t++) {
+			threads[t].join();
+			SPINE_CHECK(passed[t]);
+		}
+
+		for (int i = 0; i < 3; i++)
+			delete expected[i];
+	}
+
+	/// Updating independent branches with a task runner must give the same pose as updating on the calling thread.
+	void testTaskRunner() {
+		SkeletonData *data = TestUtil::createSkeletonData(4, 16);
+		ThreadPoolTaskRunner runner(2);
+		Skeleton serial(data), parallel(data);
+		parallel.setTaskRunner(&runner);
+		parallel.setParallelBranchSize(8);
+		SPINE_CHECK(parallel.getParallelBranchSize() == 8);
+		Animation *animation = data->findAnimation("wave");
+		for (int i = 0; i < 10; i++) {
+			animation->apply(serial, 0, i * 0.1f, true, NULL, 1, MixBlend_Setup, MixDirection_In);
+			animation->apply(parallel, 0, i * 0.1f, true, NULL, 1, MixBlend_Setup, MixDirection_In);
+			serial.updateWorldTransform();
+			parallel.updateWorldTransform();
+			SPINE_CHECK(samePose(serial, parallel));
+		}
+		delete data;
+	}
+
+	/// Compiling the branches again after the branch size changes replaces their runs instead of adding to them.
+	void testParallelBranchSizeChanges() {
+		SkeletonData *data = TestUtil::createSkeletonData(4, 16);
+		ThreadPoolTaskRunner runner(2);
+		Skeleton skeleton(data);
+		skeleton.setTaskRunner(&runner);
+		skeleton.updateWorldTransform();
+		size_t programRuns = skeleton.getNormalRuns().size(), branchRuns = 0;
+		for (int i = 0; i < 10; i++) {
+			skeleton.setParallelBranchSize(i % 2 == 0 ? 8 : 1000);
+			skeleton.updateWorldTransform();
+			size_t runs = skeleton.getNormalRuns().size();
+			if (i % 2 == 0) {
+				if (i == 0) branchRuns = runs;
+				SPINE_CHECK(runs > programRuns);
+				SPINE_CHECK(runs == branchRuns);
+			} else
+				SPINE_CHECK(runs == programRuns);
+		}
+		delete data;
+	}
+
+	/// A skeleton's bones read and write their transforms in the skeleton's pose. A bone created outside the skeleton has a
+	/// pose of its own, also when its data is in the skeleton.
+	void testBonePose(SkeletonData *data) {
+		Skeleton skeleton(data);
+		skeleton.updateWorldTransform();
+		SkeletonPose &pose = skeleton.getPose();
+		Bone *bone = skeleton.getBones()[1];
+		int index = bone->getData().getIndex();
+		bone->setX(12);
+		bone->setWorldY(-3);
+		SPINE_CHECK(pose.getChannel(PoseChannel_X)[index] == 12);
+		SPINE_CHECK(pose.getChannel(PoseChannel_WorldY)[index] == -3);
+		pose.getChannel(PoseChannel_AShearY)[index] = 7;
+		SPINE_CHECK(bone->getAShearY() == 7);
+
+		Skeleton *clone = skeleton.clone();
+		SPINE_CHECK(clone->getBones()[1]->getX() == 12);
+		clone->getBones()[1]->setX(5);
+		SPINE_CHECK(bone->getX() == 12);
+		SPINE_CHECK(clone->getPose().getChannel(PoseChannel_X)[index] == 5);
+		delete clone;
+
+		BoneData extraData((int) data->getBones().size(), "extra", data->getBones()[0]);
+		extraData.setX(4);
+		extraData.setRotation(90);
+		Bone extra(extraData, skeleton, skeleton.getRootBone());
+		SPINE_CHECK(extra.getX() == 4);
+		extra.updateWorldTransform();
+		Bone *root = skeleton.getRootBone();
+		SPINE_CHECK_NEAR(extra.getWorldX(), root->getWorldX() + root->getA() * 4, 1e-5f);
+		SPINE_CHECK_NEAR(extra.getWorldY(), root->getWorldY() + root->getC() * 4, 1e-5f);
+		SPINE_CHECK(pose.getChannel(PoseChannel_X)[index] == 12);
+
+		Bone copy(bone->getData(), skeleton, skeleton.getRootBone());
+		SPINE_CHECK(copy.getX() == bone->getData().getX());
+		copy.setX(6);
+		SPINE_CHECK(bone->getX() == 12);
+	}
+}
+
+int main() {
+	SkeletonData *data = TestUtil::readSkeletonData("constraints.json");
+	testUpdateOrderCache(data);
+	testThreads(data);
+	testBonePose(data);
+	delete data;
+	testTaskRunner();
+	testParallelBranchSizeChanges();
+	return TestUtil::finish("SkeletonTest");
+}
@@ -0,0 +1,103 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "TestUtil.h"
+
+#include <thread>
+
+using namespace spine;
+
+// Measures when Skeleton::updateWorldTransform() with a ThreadPoolTaskRunner beats updating on the calling thread, to
+// choose Skeleton::DefaultParallelBranchSize. Each skeleton has one chain of bones per thread below the root, so each
+// thread gets one branch of the chain length.
+namespace {
+	void emptyTask(void *context, size_t index) {
+		SP_UNUSED(context);
+		SP_UNUSED(index);
+	}
+
+	/// @return Microseconds per update.
+	double timeUpdates(Skeleton &skeleton) {
+		int count = 1;
+		for (;;) {
+			double start = TestUtil::seconds();
+			for (int i = 0; i < count; i++)
+				skeleton.updateWorldTransform();
+			double elapsed = TestUtil::seconds() - start;
+			if (elapsed > 0.2) return elapsed * 1e6 / count;
+			count *= 2;
+		}
+	}
+}
+
+int main() {
+	int threads = (int) std::thread::hardware_concurrency();
+	if (threads < 2) {
+		printf("Only one hardware thread, the parallel times include switching between the threads.\n");
+		threads = 2;
+	}
+	ThreadPoolTaskRunner runner(threads - 1);
+
+	const int runs = 20000;
+	double start = TestUtil::seconds();
+	for (int i = 0; i < runs; i++)
+		runner.run(emptyTask, NULL, threads);
+	double overhead = (TestUtil::seconds() - start) * 1e6 / runs;
+	printf("%d threads, run() of empty tasks: %.2f us\n\n", threads, overhead);
+
+	printf("branch size  serial us  parallel us  speedup\n");
+	size_t crossover = 0;
+	double entryTime = 0;
+	for (int size = 16; size <= 2048; size *= 2) {
+		SkeletonData *skeletonData = TestUtil::createSkeletonData(threads, size);
+		Skeleton serial(skeletonData), parallel(skeletonData);
+		parallel.setTaskRunner(&runner);
+		parallel.setParallelBranchSize(size);
+		Animation *animation = skeletonData->findAnimation("wave");
+		animation->apply(serial, 0, 0.3f, true, NULL, 1, MixBlend_Setup, MixDirection_In);
+		animation->apply(parallel, 0, 0.3f, true, NULL, 1, MixBlend_Setup, MixDirection_In);
+
+		double serialTime = timeUpdates(serial), parallelTime = timeUpdates(parallel);
+		printf("%11d  %9.2f  %11.2f  %7.2f\n", size, serialTime, parallelTime, serialTime / parallelTime);
+		entryTime = serialTime / (threads * size);
+		if (parallelTime < serialTime) {
+			if (crossover == 0) crossover = size;
+		} else
+			crossover = 0;
+		delete skeletonData;
+	}
+	// Each thread saves the time of a branch and pays for run().
+	printf("\nSerial update per entry: %.3f us, run() costs as much as %d entries.\n", entryTime,
+		   (int) (overhead / entryTime + 0.5));
+	if (crossover)
+		printf("Parallel updates are faster from branches of %d update cache entries.\n", (int) crossover);
+	else
+		printf("Parallel updates are not faster for any branch size measured.\n");
+	return 0;
+}
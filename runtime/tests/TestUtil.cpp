@@ -0,0 +1,117 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "TestUtil.h"
+
+#include <chrono>
+#include <stdlib.h>
+#include <string>
+
+using namespace spine;
+
+namespace spine {
+	SpineExtension *getDefaultExtension() {
+		return new DefaultSpineExtension();
+	}
+}
+
+int TestUtil::_failures = 0;
+
+SkeletonData *TestUtil::readSkeletonData(const char *fileName) {
+	String path(SPINE_TEST_DATA_DIR "/");
+	path.append(fileName);
+	SkeletonJson json((Atlas *) NULL);
+	SkeletonData *skeletonData = json.readSkeletonDataFile(path);
+	if (!skeletonData) {
+		fprintf(stderr, "Unable to read %s: %s\n", path.buffer(), json.getError().buffer());
+		exit(1);
+	}
+	return skeletonData;
+}
+
+SkeletonData *TestUtil::createSkeletonData(int chainCount, int chainLength) {
+	std::string json = "{\"skeleton\":{\"spine\":\"4.1.00\"},\"bones\":[{\"name\":\"root\"}";
+	char buffer[256];
+	for (int chain = 0; chain < chainCount; chain++) {
+		for (int i = 0; i < chainLength; i++) {
+			if (i == 0)
+				snprintf(buffer, sizeof(buffer), ",{\"name\":\"%d-0\",\"parent\":\"root\",\"rotation\":%d}", chain,
+						 chain * 360 / chainCount);
+			else
+				snprintf(buffer, sizeof(buffer),
+						 ",{\"name\":\"%d-%d\",\"parent\":\"%d-%d\",\"length\":10,\"x\":10,\"rotation\":5}",
+						 chain, i, chain, i - 1);
+			json += buffer;
+		}
+	}
+	json += "],\"animations\":{\"wave\":{\"bones\":{";
+	for (int chain = 0; chain < chainCount; chain++) {
+		for (int i = 0; i < chainLength; i++) {
+			snprintf(buffer, sizeof(buffer),
+					 "%s\"%d-%d\":{\"rotate\":[{\"curve\":[0.25,0,0.5,%d]},{\"time\":0.5,\"value\":%d,"
+					 "\"curve\":[0.75,%d,0.9,0]},{\"time\":1}]",
+					 chain == 0 && i == 0 ? "" : ",", chain, i, 10 + i % 7, 10 + i % 7, 10 + i % 7);
+			json += buffer;
+			if (i == 0) json += ",\"translate\":[{\"x\":0,\"y\":0},{\"time\":0.5,\"x\":4,\"y\":-2},{\"time\":1}]";
+			json += "}";
+		}
+	}
+	json += "}}}}";
+
+	SkeletonJson reader((Atlas *) NULL);
+	SkeletonData *skeletonData = reader.readSkeletonData(json.c_str());
+	if (!skeletonData) {
+		fprintf(stderr, "Unable to create a skeleton: %s\n", reader.getError().buffer());
+		exit(1);
+	}
+	return skeletonData;
+}
+
+void TestUtil::fail(const char *file, int line, const char *condition) {
+	fprintf(stderr, "%s:%d: check failed: %s\n", file, line, condition);
+	_failures++;
+}
+
+void TestUtil::fail(const char *file, int line, const char *condition, float a, float b) {
+	fprintf(stderr, "%s:%d: check failed: %s (%.9g vs %.9g)\n", file, line, condition, a, b);
+	_failures++;
+}
+
+int TestUtil::finish(const char *testName) {
+	if (_failures) {
+		fprintf(stderr, "%s: %d checks failed\n", testName, _failures);
+		return 1;
+	}
+	printf("%s: passed\n", testName);
+	return 0;
+}
+
+double TestUtil::seconds() {
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
@@ -0,0 +1,77 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_TestUtil_h
+#define Spine_TestUtil_h
+
+#include <spine/spine.h>
+
+#include <stdio.h>
+
+/// Reports a failed check and counts it, without stopping the test.
+#define SPINE_CHECK(condition) \
+	do { \
+		if (!(condition)) spine::TestUtil::fail(__FILE__, __LINE__, #condition); \
+	} while (0)
+
+/// Checks two floats are within the tolerance, reporting both values if not.
+#define SPINE_CHECK_NEAR(a, b, tolerance) \
+	do { \
+		float _a = (float) (a), _b = (float) (b); \
+		if (!(_a - _b <= (tolerance) && _b - _a <= (tolerance))) \
+			spine::TestUtil::fail(__FILE__, __LINE__, #a " ~ " #b, _a, _b); \
+	} while (0)
+
+namespace spine {
+	class TestUtil {
+	public:
+		/// Reads a skeleton from the tests/data directory, or exits if it can't be read.
+		static SkeletonData *readSkeletonData(const char *fileName);
+
+		/// Creates a skeleton with chainCount chains of chainLength bones below the root, for benchmarks. Its "wave"
+		/// animation has a bezier rotate timeline for every bone and a translate timeline for the first bone of each
+		/// chain.
+		static SkeletonData *createSkeletonData(int chainCount, int chainLength);
+
+		static void fail(const char *file, int line, const char *condition);
+
+		static void fail(const char *file, int line, const char *condition, float a, float b);
+
+		/// @return The exit code of the test: 0 if no check failed.
+		static int finish(const char *testName);
+
+		/// Seconds since an arbitrary point, for benchmarks.
+		static double seconds();
+
+	private:
+		static int _failures;
+	};
+}
+
+#endif /* Spine_TestUtil_h */
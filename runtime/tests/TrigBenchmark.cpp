@@ -0,0 +1,105 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "TestUtil.h"
+
+#include <stdlib.h>
+
+using namespace spine;
+
+// Measures the throughput of each trig mode: MathUtil::sinCosDeg() as BoneKernel uses it, sinDeg() and cosDeg() one angle
+// at a time as Bone uses them, and atan2().
+namespace {
+	const int Count = 4096;
+	float degrees[Count], xs[Count], sines[Count], cosines[Count];
+	volatile float sink;
+
+	/// @return Nanoseconds per angle.
+	double timeSinCosDeg() {
+		int count = 1;
+		for (;;) {
+			double start = TestUtil::seconds();
+			for (int i = 0; i < count; i++)
+				MathUtil::sinCosDeg(degrees, sines, cosines, Count);
+			double elapsed = TestUtil::seconds() - start;
+			sink = sines[count & (Count - 1)];
+			if (elapsed > 0.2) return elapsed * 1e9 / ((double) count * Count);
+			count *= 2;
+		}
+	}
+
+	double timeSinDegCosDeg() {
+		int count = 1;
+		for (;;) {
+			double start = TestUtil::seconds();
+			float sum = 0;
+			for (int i = 0; i < count; i++) {
+				for (int ii = 0; ii < Count; ii++)
+					sum += MathUtil::sinDeg(degrees[ii]) + MathUtil::cosDeg(degrees[ii]);
+			}
+			double elapsed = TestUtil::seconds() - start;
+			sink = sum;
+			if (elapsed > 0.2) return elapsed * 1e9 / ((double) count * Count);
+			count *= 2;
+		}
+	}
+
+	double timeAtan2() {
+		int count = 1;
+		for (;;) {
+			double start = TestUtil::seconds();
+			float sum = 0;
+			for (int i = 0; i < count; i++) {
+				for (int ii = 0; ii < Count; ii++)
+					sum += MathUtil::atan2(degrees[ii], xs[ii]);
+			}
+			double elapsed = TestUtil::seconds() - start;
+			sink = sum;
+			if (elapsed > 0.2) return elapsed * 1e9 / ((double) count * Count);
+			count *= 2;
+		}
+	}
+}
+
+int main() {
+	srand(7);
+	for (int i = 0; i < Count; i++) {
+		degrees[i] = -720 + 1440 * (float) rand() / RAND_MAX;
+		xs[i] = -720 + 1440 * (float) rand() / RAND_MAX;
+	}
+
+	const TrigMode modes[] = {TrigMode_Exact, TrigMode_Polynomial, TrigMode_Table};
+	const char *modeNames[] = {"exact", "polynomial", "table"};
+	printf("ns per angle  sinCosDeg  sinDeg+cosDeg  atan2\n");
+	for (int m = 0; m < 3; m++) {
+		MathUtil::setTrigMode(modes[m]);
+		printf("%-12s  %9.2f  %13.2f  %5.2f\n", modeNames[m], timeSinCosDeg(), timeSinDegCosDeg(), timeAtan2());
+	}
+	return 0;
+}
@@ -0,0 +1,154 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "TestUtil.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+using namespace spine;
+
+// Checks each trig mode against double precision libm, within the error TrigMode documents, and that
+// MathUtil::sinCosDeg() gives the same results as sinDeg() and cosDeg().
+namespace {
+	const double DegRad = 3.14159265358979323846 / 180;
+
+	/// Angles in degrees: a fine sweep of a few turns, then random angles up to 3600 degrees either way.
+	void angles(Vector<float> &out) {
+		for (int i = -72000; i <= 72000; i++)
+			out.add(i * 0.01f);
+		srand(3);
+		for (int i = 0; i < 100000; i++)
+			out.add(-3600 + 7200 * (float) rand() / RAND_MAX);
+	}
+
+	void testSinCos(TrigMode mode, const char *name, float degTolerance, float radTolerance, Vector<float> &degrees) {
+		MathUtil::setTrigMode(mode);
+		double maxDegError = 0, maxRadError = 0;
+		for (size_t i = 0, n = degrees.size(); i < n; i++) {
+			// The reference uses the float angle as given, so the error includes converting it to radians.
+			double angle = degrees[i], sine = sin(angle * DegRad), cosine = cos(angle * DegRad);
+			maxDegError = fmax(maxDegError, fabs(MathUtil::sinDeg(degrees[i]) - sine));
+			maxDegError = fmax(maxDegError, fabs(MathUtil::cosDeg(degrees[i]) - cosine));
+
+			// Radians only need to be accurate for the angles Spine passes, which come from atan2 or are within a turn.
+			float radians = (float) (fmod(angle, 360) * DegRad);
+			maxRadError = fmax(maxRadError, fabs(MathUtil::sin(radians) - sin((double) radians)));
+			maxRadError = fmax(maxRadError, fabs(MathUtil::cos(radians) - cos((double) radians)));
+		}
+		printf("%-10s sinDeg/cosDeg max error %.3g, sin/cos %.3g\n", name, maxDegError, maxRadError);
+		SPINE_CHECK(maxDegError <= degTolerance);
+		SPINE_CHECK(maxRadError <= radTolerance);
+
+		// The vector path must match the scalar functions exactly, including a remainder not a multiple of four.
+		const size_t count = 1023;
+		float sines[count], cosines[count];
+		for (size_t start = 0; start + count <= degrees.size(); start += 50 * count) {
+			MathUtil::sinCosDeg(degrees.buffer() + start, sines, cosines, count);
+			for (size_t i = 0; i < count; i++) {
+				SPINE_CHECK(sines[i] == MathUtil::sinDeg(degrees[start + i]));
+				SPINE_CHECK(cosines[i] == MathUtil::cosDeg(degrees[start + i]));
+			}
+		}
+	}
+
+	bool same(float a, float b) {
+		return a == b || (a != a && b != b);
+	}
+
+	/// Angles too large to round to a quadrant or table index directly are reduced first, the same way by the scalar and
+	/// vector paths. Infinity and NaN give NaN. Only the polynomials keep their accuracy, libm and the table are given
+	/// the angle after a conversion which loses it.
+	void testLargeAngles(TrigMode mode) {
+		MathUtil::setTrigMode(mode);
+		float degrees[] = {1048576.0f, -1048576.0f, 4194303.5f, 4194304.5f, -6291456.5f, 8388607.0f, 1e7f, -3.5e8f,
+						   1e9f, 3e38f, -3e38f, INFINITY, -INFINITY, NAN, 12345.5f, -720.25f};
+		const size_t count = sizeof(degrees) / sizeof(degrees[0]);
+		float sines[count], cosines[count];
+		MathUtil::sinCosDeg(degrees, sines, cosines, count);
+		double maxError = 0;
+		for (size_t i = 0; i < count; i++) {
+			float sine = MathUtil::sinDeg(degrees[i]), cosine = MathUtil::cosDeg(degrees[i]);
+			SPINE_CHECK(same(sines[i], sine));
+			SPINE_CHECK(same(cosines[i], cosine));
+			if (isinf(degrees[i]) || isnan(degrees[i])) {
+				SPINE_CHECK(isnan(sine) && isnan(cosine));
+				continue;
+			}
+			double angle = fmod((double) degrees[i], 360) * DegRad;
+			maxError = fmax(maxError, fmax(fabs(sine - sin(angle)), fabs(cosine - cos(angle))));
+		}
+		SPINE_CHECK(isnan(MathUtil::sin(INFINITY)) && isnan(MathUtil::cos(NAN)));
+		if (mode != TrigMode_Polynomial) return;
+		for (float radians = 1e5f; radians < 1e9f; radians *= 7.3f) {
+			maxError = fmax(maxError, fabs(MathUtil::sin(radians) - sin((double) radians)));
+			maxError = fmax(maxError, fabs(MathUtil::cos(-radians) - cos((double) radians)));
+		}
+		printf("polynomial large angles max error %.3g\n", maxError);
+		// Radians are reduced by a double turn and rounded to float.
+		SPINE_CHECK(maxError <= 4e-7f);
+	}
+
+	void testAtan2(TrigMode mode, const char *name, float tolerance) {
+		MathUtil::setTrigMode(mode);
+		double maxError = 0;
+		srand(5);
+		for (int i = 0; i < 200000; i++) {
+			float y = -100 + 200 * (float) rand() / RAND_MAX, x = -100 + 200 * (float) rand() / RAND_MAX;
+			if (i < 4) {
+				// The axes.
+				x = i & 1 ? 0 : (i & 2 ? -1.0f : 1.0f);
+				y = i & 1 ? (i & 2 ? -1.0f : 1.0f) : 0;
+			}
+			maxError = fmax(maxError, fabs(MathUtil::atan2(y, x) - atan2((double) y, (double) x)));
+		}
+		printf("%-10s atan2 max error %.3g\n", name, maxError);
+		SPINE_CHECK(maxError <= tolerance);
+	}
+}
+
+int main() {
+	TrigMode defaultMode = MathUtil::getTrigMode();
+	Vector<float> degrees;
+	angles(degrees);
+
+	// libm is given the angle in float radians, which for thousands of degrees is off by a few ulp of the angle.
+	testSinCos(TrigMode_Exact, "exact", 4e-6f, 1e-7f, degrees);
+	testSinCos(TrigMode_Polynomial, "polynomial", 2e-7f, 2e-7f, degrees);
+	testSinCos(TrigMode_Table, "table", 2e-4f, 2e-4f, degrees);
+	testLargeAngles(TrigMode_Exact);
+	testLargeAngles(TrigMode_Polynomial);
+	testLargeAngles(TrigMode_Table);
+	testAtan2(TrigMode_Exact, "exact", 3e-7f);
+	testAtan2(TrigMode_Polynomial, "polynomial", 4e-7f);
+	testAtan2(TrigMode_Table, "table", 4e-7f);
+
+	MathUtil::setTrigMode(defaultMode);
+	return TestUtil::finish("TrigTest");
+}
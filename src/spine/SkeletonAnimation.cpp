@@ -28,6 +28,8 @@
  *****************************************************************************/
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <spine/Extension.h>
 #include <spine/SkeletonAnimation.h>
 #include <spine/spine-axmol.h>
@@ -121,7 +123,8 @@ namespace spine {
 	}
 
 	SkeletonAnimation::SkeletonAnimation()
-		: SkeletonRenderer() {
+		: SkeletonRenderer(), _updateRate(UpdateRate_Full), _fullRateSize(256), _halfRateSize(128), _skippedFrames(0),
+		  _hasLastPoses(false) {
 	}
 
 	SkeletonAnimation::~SkeletonAnimation() {
@@ -135,11 +138,122 @@ namespace spine {
 		super::update(deltaTime);
 
 		deltaTime *= _timeScale;
+		int interval = getUpdateInterval();
+		if (interval > 1 && _hasLastPoses && ++_skippedFrames < interval) {
+			_state->update(deltaTime);
+			_state->applyEvents();
+			interpolateWorldTransforms((float) _skippedFrames / interval);
+			return;
+		}
+		_skippedFrames = 0;
+		if (_hasLastPoses) {
+			// The shown world transforms are interpolated. Put back the newest pose, so bones an incremental
+			// updateWorldTransform() skips keep their own transforms, and the next pose saved is the right one.
+			SkeletonPose &pose = _skeleton->getPose();
+			size_t size = pose.getStride() * (PoseChannel_Count - PoseChannel_A);
+			memcpy(pose.getChannel(PoseChannel_A), _lastPoses.buffer() + size, sizeof(float) * size);
+			if (interval == 1) _hasLastPoses = false;
+		}
+
 		if (_preUpdateListener) _preUpdateListener(this);
 		_state->update(deltaTime);
 		_state->apply(*_skeleton);
 		_skeleton->updateWorldTransform();
 		if (_postUpdateListener) _postUpdateListener(this);
+
+		if (interval > 1) {
+			// Keep the last two poses, then show the older one. Later frames move toward the newer one.
+			SkeletonPose &pose = _skeleton->getPose();
+			size_t size = pose.getStride() * (PoseChannel_Count - PoseChannel_A);
+			const float *world = pose.getChannel(PoseChannel_A);
+			if (!_hasLastPoses) {
+				_lastPoses.setSize(size * 2, 0);
+				memcpy(_lastPoses.buffer(), world, sizeof(float) * size);
+				_hasLastPoses = true;
+			} else
+				memcpy(_lastPoses.buffer(), _lastPoses.buffer() + size, sizeof(float) * size);
+			memcpy(_lastPoses.buffer() + size, world, sizeof(float) * size);
+			interpolateWorldTransforms(0);
+		}
+	}
+
+	int SkeletonAnimation::getUpdateInterval() {
+		switch (_updateRate) {
+			case UpdateRate_Half:
+				return 2;
+			case UpdateRate_Quarter:
+				return 4;
+			case UpdateRate_ScreenSize: {
+				float size = getScreenSize();
+				return size < 0 || size >= _fullRateSize ? 1 : (size >= _halfRateSize ? 2 : 4);
+			}
+			default:
+				return 1;
+		}
+	}
+
+	float SkeletonAnimation::getScreenSize() {
+		SkeletonData *data = _skeleton->getData();
+		if (data->getWidth() <= 0 || data->getHeight() <= 0) return -1;
+
+		/* Project through the camera that draws this node, so perspective and zoom change the size. */
+		Scene *scene = getScene();
+		if (!scene) return -1;
+		Camera *camera = nullptr;
+		for (Camera *sceneCamera : scene->getCameras()) {
+			if ((unsigned short) sceneCamera->getCameraFlag() & getCameraMask()) {
+				camera = sceneCamera;
+				break;
+			}
+		}
+		if (!camera) return -1;
+
+		const Mat4 &transform = getNodeToWorldTransform();
+		float minX = 0, minY = 0, maxX = 0, maxY = 0;
+		for (int i = 0; i < 4; i++) {
+			Vec3 corner(data->getX() + (i & 1 ? data->getWidth() : 0), data->getY() + (i & 2 ? data->getHeight() : 0), 0);
+			transform.transformPoint(&corner);
+			Vec2 screen = camera->projectGL(corner);
+			minX = i == 0 ? screen.x : min(minX, screen.x);
+			minY = i == 0 ? screen.y : min(minY, screen.y);
+			maxX = i == 0 ? screen.x : max(maxX, screen.x);
+			maxY = i == 0 ? screen.y : max(maxY, screen.y);
+		}
+		return max(maxX - minX, maxY - minY);
+	}
+
+	/* Interpolates a world axis by its angle, the shorter way around, and its length, so a rotating bone keeps its size
+	 * instead of shrinking toward the chord between the two poses. */
+	static void interpolateAxis(float fromX, float fromY, float toX, float toY, float alpha, float &outX, float &outY) {
+		float fromAngle = MathUtil::atan2(fromY, fromX), angle = MathUtil::atan2(toY, toX) - fromAngle;
+		if (angle > MathUtil::Pi) angle -= MathUtil::Pi_2;
+		else if (angle < -MathUtil::Pi) angle += MathUtil::Pi_2;
+		angle = fromAngle + angle * alpha;
+		float fromLength = MathUtil::sqrt(fromX * fromX + fromY * fromY);
+		float length = fromLength + (MathUtil::sqrt(toX * toX + toY * toY) - fromLength) * alpha;
+		outX = MathUtil::cos(angle) * length;
+		outY = MathUtil::sin(angle) * length;
+	}
+
+	void SkeletonAnimation::interpolateWorldTransforms(float alpha) {
+		SkeletonPose &pose = _skeleton->getPose();
+		size_t stride = pose.getStride(), size = stride * (PoseChannel_Count - PoseChannel_A);
+		const float *from = _lastPoses.buffer(), *to = from + size;
+		float *world = pose.getChannel(PoseChannel_A);
+		if (alpha == 0) {
+			memcpy(world, from, sizeof(float) * size);
+			return;
+		}
+		/* The x axis is (a, c) and the y axis (b, d), each interpolated on its own so shear is kept too. */
+		size_t a = 0, b = stride * (PoseChannel_B - PoseChannel_A), c = stride * (PoseChannel_C - PoseChannel_A),
+			   d = stride * (PoseChannel_D - PoseChannel_A), x = stride * (PoseChannel_WorldX - PoseChannel_A),
+			   y = stride * (PoseChannel_WorldY - PoseChannel_A);
+		for (size_t i = 0, n = _skeleton->getBones().size(); i < n; i++) {
+			interpolateAxis(from[a + i], from[c + i], to[a + i], to[c + i], alpha, world[a + i], world[c + i]);
+			interpolateAxis(from[b + i], from[d + i], to[b + i], to[d + i], alpha, world[b + i], world[d + i]);
+			world[x + i] = from[x + i] + (to[x + i] - from[x + i]) * alpha;
+			world[y + i] = from[y + i] + (to[y + i] - from[y + i]) * alpha;
+		}
 	}
 
 	void SkeletonAnimation::draw(axmol::Renderer *renderer, const axmol::Mat4 &transform, uint32_t transformFlags) {
@@ -324,4 +438,17 @@ namespace spine {
 		_updateOnlyIfVisible = status;
 	}
 
+	void SkeletonAnimation::setUpdateRate(UpdateRate rate) {
+		_updateRate = rate;
+	}
+
+	UpdateRate SkeletonAnimation::getUpdateRate() const {
+		return _updateRate;
+	}
+
+	void SkeletonAnimation::setUpdateRateScreenSizes(float fullRateSize, float halfRateSize) {
+		_fullRateSize = fullRateSize;
+		_halfRateSize = halfRateSize;
+	}
+
 }// namespace spine
@@ -45,6 +45,15 @@ namespace spine {
 	typedef std::function<void(TrackEntry *entry, Event *event)> EventListener;
 	typedef std::function<void(SkeletonAnimation *node)> UpdateWorldTransformsListener;
 
+	/** How often a SkeletonAnimation poses its skeleton. */
+	enum UpdateRate {
+		UpdateRate_Full,
+		UpdateRate_Half,
+		UpdateRate_Quarter,
+		/** Full, half or quarter rate, chosen each frame from the node's size on screen. See setUpdateRateScreenSizes(). */
+		UpdateRate_ScreenSize
+	};
+
 	/** Draws an animated skeleton, providing an AnimationState for applying one or more animations and queuing animations to be
   * played later. */
 	class SP_API SkeletonAnimation : public SkeletonRenderer {
@@ -102,6 +111,20 @@ namespace spine {
 		AnimationState *getState() const;
 		void setUpdateOnlyIfVisible(bool status);
 
+		/* Below full rate, the animation state is still updated every frame so events are raised on time, but the skeleton is
+		 * only posed every 2nd or 4th frame. Frames in between show bone world transforms interpolated between the last two
+		 * poses, so the displayed bones trail the animation by one interval. Only the bones trail: slot colors, attachments,
+		 * deforms and the draw order are those of the newest pose, so for example an attachment change shows one interval
+		 * before the bones reach the matching pose. The update world transforms listeners are only called for frames that
+		 * pose the skeleton. */
+		void setUpdateRate(UpdateRate rate);
+		UpdateRate getUpdateRate() const;
+		/* For UpdateRate_ScreenSize, the size on screen in points of the skeleton's setup pose bounds at or above which the
+		 * skeleton is posed every frame, and at or above which it is posed every 2nd frame. Smaller skeletons are posed every
+		 * 4th frame. The bounds are projected through the first camera of the scene drawing this node, so the camera's
+		 * perspective and zoom are taken into account. Outside a scene the skeleton is posed every frame. */
+		void setUpdateRateScreenSizes(float fullRateSize, float halfRateSize);
+
 		SkeletonAnimation();
 		virtual ~SkeletonAnimation();
 		virtual void initialize() override;
@@ -113,6 +136,14 @@ namespace spine {
 		bool _updateOnlyIfVisible;
 		bool _firstDraw;
 
+		UpdateRate _updateRate;
+		float _fullRateSize;
+		float _halfRateSize;
+		int _skippedFrames;
+		bool _hasLastPoses;
+		/* The bone world transforms of the last two poses, when posing below full rate. */
+		Vector<float> _lastPoses;
+
 		StartListener _startListener;
 		InterruptListener _interruptListener;
 		EndListener _endListener;
@@ -122,6 +153,11 @@ namespace spine {
 		UpdateWorldTransformsListener _preUpdateListener;
 		UpdateWorldTransformsListener _postUpdateListener;
 
+		int getUpdateInterval();
+		/* The larger side of the projected setup pose bounds in points, or -1 if unknown. */
+		float getScreenSize();
+		void interpolateWorldTransforms(float alpha);
+
 	private:
 		typedef SkeletonRenderer super;
 	};